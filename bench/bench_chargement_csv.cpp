@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "commun.hpp"
+
+// Ancien chargeur (getline + stringstream par ligne), gardé comme référence.
+std::size_t chargerCommeAvant(const std::filesystem::path& fichier) {
+    std::ifstream entree(fichier);
+    std::vector<TacheAoS> taches;
+    std::string ligne;
+    while (std::getline(entree, ligne)) {
+        std::stringstream buffer(ligne);
+        std::string idStr, description, statutStr, prioriteStr, dateStr;
+        if (!std::getline(buffer, idStr, ';') || !std::getline(buffer, description, ';') ||
+            !std::getline(buffer, statutStr, ';') || !std::getline(buffer, prioriteStr, ';') ||
+            !std::getline(buffer, dateStr)) {
+            continue;
+        }
+        int id = 0;
+        try {
+            id = std::stoi(idStr);
+        } catch (const std::exception&) {
+            continue;
+        }
+        std::stringstream descStream(description);
+        std::string descriptionDecodee;
+        descStream >> std::quoted(descriptionDecodee);
+        auto statut = statutDepuisTexte(statutStr);
+        auto priorite = prioriteDepuisTexte(prioriteStr);
+        if (statut && priorite) {
+            taches.push_back({id, descriptionDecodee, *statut, *priorite, dateStr});
+        }
+    }
+    return taches.size();
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2'000'000;
+    const auto fichier = std::filesystem::temp_directory_path() / "bench_taches.csv";
+
+    {
+        GestionnaireTaches source;
+        genererTaches(source, nbTaches);
+        source.sauvegarderCSV(fichier);
+    }
+    const double megaOctets = static_cast<double>(std::filesystem::file_size(fichier)) / 1e6;
+
+    // Meilleur temps sur trois essais ; chaque gestionnaire est détruit
+    // avant l'essai suivant pour ne pas mesurer la pression mémoire.
+    auto mesurer = [](auto&& essai) {
+        double meilleur = 1e300;
+        for (int i = 0; i < 3; ++i) {
+            meilleur = std::min(meilleur, essai());
+        }
+        return meilleur;
+    };
+    auto charger = [&fichier](ModeChargement mode, std::vector<TacheAoS>& taches) {
+        GestionnaireTaches gestionnaire;
+        Chronometre chrono;
+        gestionnaire.chargerCSV(fichier, mode);
+        const double duree = chrono.secondes();
+        taches = copierTaches(gestionnaire);
+        return duree;
+    };
+
+    std::size_t nbAvant = 0;
+    const double dureeAvant = mesurer([&] {
+        Chronometre chrono;
+        nbAvant = chargerCommeAvant(fichier);
+        return chrono.secondes();
+    });
+
+    std::vector<TacheAoS> tachesFlux;
+    const double dureeFlux = mesurer([&] { return charger(ModeChargement::Flux, tachesFlux); });
+
+    std::vector<TacheAoS> tachesProjection;
+    const double dureeProjection =
+        mesurer([&] { return charger(ModeChargement::Projection, tachesProjection); });
+
+    std::cout << "Fichier : " << megaOctets << " Mo, " << nbTaches << " tâches\n"
+              << "  ancien chargeur : " << megaOctets / dureeAvant << " Mo/s (" << nbAvant
+              << " tâches : les descriptions contenant ';' étaient perdues)\n"
+              << "  Flux            : " << megaOctets / dureeFlux << " Mo/s\n"
+              << "  Projection      : " << megaOctets / dureeProjection << " Mo/s\n"
+              << "  mêmes tâches    : "
+              << (tachesFlux == tachesProjection ? "oui" : "NON") << "\n";
+
+    std::filesystem::remove(fichier);
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_chargement_csv.cpp -o bench_chargement_csv
+ * ./bench_chargement_csv [nbTaches]
+ */
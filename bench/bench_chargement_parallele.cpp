@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+#include "commun.hpp"
+
+// Passage à l'échelle de chargerCSV (mode Projection) selon le nombre de threads.
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4'000'000;
+    const unsigned maxThreads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 16;
+    const auto fichier = std::filesystem::temp_directory_path() / "bench_taches_parallele.csv";
+
+    {
+        GestionnaireTaches source;
+        genererTaches(source, nbTaches);
+        source.sauvegarderCSV(fichier);
+    }
+    const double megaOctets = static_cast<double>(std::filesystem::file_size(fichier)) / 1e6;
+
+    std::vector<int> reference;
+    {
+        GestionnaireTaches flux;
+        flux.chargerCSV(fichier, ModeChargement::Flux);
+        flux.pourChaqueTache([&](const Tache& t) { reference.push_back(t.id); });
+    }
+
+    std::cout << "Fichier : " << megaOctets << " Mo, " << nbTaches << " tâches, "
+              << nombreThreadsParDefaut() << " coeurs disponibles\n";
+    double dureeUnThread = 0;
+    for (unsigned nbThreads = 1; nbThreads <= maxThreads; nbThreads *= 2) {
+        double meilleur = 1e300;
+        bool memeOrdre = true;
+        for (int essai = 0; essai < 3; ++essai) {
+            GestionnaireTaches gestionnaire;
+            Chronometre chrono;
+            gestionnaire.chargerCSV(fichier, ModeChargement::Projection, nbThreads);
+            meilleur = std::min(meilleur, chrono.secondes());
+
+            std::size_t i = 0;
+            gestionnaire.pourChaqueTache([&](const Tache& t) {
+                memeOrdre = memeOrdre && i < reference.size() && reference[i] == t.id;
+                ++i;
+            });
+            memeOrdre = memeOrdre && i == reference.size();
+        }
+        if (nbThreads == 1) {
+            dureeUnThread = meilleur;
+        }
+        std::cout << "  " << nbThreads << " thread(s) : " << megaOctets / meilleur << " Mo/s, x"
+                  << dureeUnThread / meilleur << (memeOrdre ? "" : "  ORDRE DIFFÉRENT") << "\n";
+    }
+
+    std::filesystem::remove(fichier);
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_chargement_parallele.cpp -o bench_chargement_parallele
+ * ./bench_chargement_parallele [nbTaches] [maxThreads]
+ */
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "commun.hpp"
+
+// Compare le stockage en colonnes (TableTaches) à l'ancien vecteur
+// d'enregistrements (TacheAoS) sur les parcours typiques de la todo app :
+// compter par statut, filtrer par statut, trier par priorité.
+template <typename Essai>
+double meilleurDe3(Essai&& essai) {
+    double meilleur = 1e300;
+    for (int i = 0; i < 3; ++i) {
+        Chronometre chrono;
+        essai();
+        meilleur = std::min(meilleur, chrono.secondes());
+    }
+    return meilleur;
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2'000'000;
+
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    for (int id = 1; id <= static_cast<int>(nbTaches); id += 3) {
+        gestionnaire.changerStatut(id, Statut::EnCours);
+    }
+    const auto aos = copierTaches(gestionnaire);
+    const auto& colonnes = gestionnaire.table().colonnes();
+
+    std::array<std::size_t, 3> comptesAoS{};
+    std::array<std::size_t, 4> comptesSoA{};
+    const double compterAoS = meilleurDe3([&] {
+        comptesAoS = {};
+        for (const auto& t : aos) {
+            ++comptesAoS[static_cast<std::size_t>(t.statut)];
+        }
+    });
+    const double compterSoA = meilleurDe3([&] {
+        comptesSoA = {};
+        for (const auto s : colonnes.statuts) {
+            ++comptesSoA[s & 3];
+        }
+    });
+
+    std::vector<int> idsAoS;
+    std::vector<int> idsSoA;
+    const double filtrerAoS = meilleurDe3([&] {
+        idsAoS.clear();
+        for (const auto& t : aos) {
+            if (t.statut == Statut::EnCours) {
+                idsAoS.push_back(t.id);
+            }
+        }
+    });
+    const double filtrerSoA = meilleurDe3([&] {
+        idsSoA.clear();
+        const auto enCours = static_cast<std::uint8_t>(Statut::EnCours);
+        for (std::size_t i = 0; i < colonnes.statuts.size(); ++i) {
+            if (colonnes.statuts[i] == enCours) {
+                idsSoA.push_back(colonnes.ids[i]);
+            }
+        }
+    });
+
+    Chronometre chrono;
+    auto triAoS = aos;
+    std::stable_sort(triAoS.begin(), triAoS.end(),
+                     [](const TacheAoS& a, const TacheAoS& b) { return a.priorite > b.priorite; });
+    const double trierAoS = chrono.secondes();
+    // Tri en colonnes : on trie une permutation sur la seule colonne des
+    // priorités, puis on réordonne toute la table en une passe.
+    auto table = gestionnaire.table();
+    chrono.redemarrer();
+    std::vector<std::size_t> ordre(table.nbLignes());
+    for (std::size_t i = 0; i < ordre.size(); ++i) {
+        ordre[i] = i;
+    }
+    const auto& priorites = table.colonnes().priorites;
+    std::stable_sort(ordre.begin(), ordre.end(),
+                     [&priorites](std::size_t a, std::size_t b) { return priorites[a] > priorites[b]; });
+    table.reordonner(ordre);
+    const double trierSoA = chrono.secondes();
+
+    const double mo = 1e6;
+    const double octetsAoS = static_cast<double>(aos.size() * sizeof(TacheAoS));
+    const double octetsStatuts = static_cast<double>(colonnes.statuts.size());
+    std::cout << nbTaches << " tâches (" << sizeof(TacheAoS)
+              << " octets par enregistrement AoS, 1 octet de statut en colonnes)\n"
+              << "  compter par statut  AoS : " << compterAoS * 1e3 << " ms ("
+              << octetsAoS / compterAoS / mo << " Mo/s lus)\n"
+              << "                      SoA : " << compterSoA * 1e3 << " ms ("
+              << octetsStatuts / compterSoA / mo << " Mo/s lus)\n"
+              << "  filtrer EnCours     AoS : " << filtrerAoS * 1e3 << " ms\n"
+              << "                      SoA : " << filtrerSoA * 1e3 << " ms\n"
+              << "  trier par priorité  AoS : " << trierAoS * 1e3 << " ms\n"
+              << "                      SoA : " << trierSoA * 1e3 << " ms\n"
+              << "  mêmes résultats     : "
+              << (idsAoS == idsSoA && comptesAoS[1] == comptesSoA[1] ? "oui" : "NON") << "\n";
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_colonnes.cpp -o bench_colonnes
+ * ./bench_colonnes [nbTaches]
+ */
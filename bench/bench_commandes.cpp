@@ -0,0 +1,77 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../projets/01-todo-app/commandes.hpp"
+#include "commun.hpp"
+
+// Un script de N ajouts puis N changements de statut, stockage journalisé :
+// une commande à la fois, réponse écrite et flushée à chaque fois (comme le
+// menu), contre executerCommandes (lots, réponses par blocs). Les réponses
+// partent dans /dev/null.
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+    const auto dossier = std::filesystem::temp_directory_path();
+    const auto instantane = dossier / "bench_commandes.bin";
+    const auto journal = dossier / "bench_commandes.journal";
+    std::ofstream sortie("/dev/null");
+
+    std::string script;
+    for (std::size_t i = 0; i < nbTaches; ++i) {
+        script += "ajouter\tMOYENNE\t2025-06-01\ttâche n°" + std::to_string(i) + "\n";
+    }
+    for (std::size_t i = 1; i <= nbTaches; ++i) {
+        script += "statut\t" + std::to_string(i) + "\tTERMINEE\n";
+    }
+
+    auto mesurer = [&](auto&& executer) {
+        std::filesystem::remove(instantane);
+        std::filesystem::remove(journal);
+        GestionnaireTaches gestionnaire;
+        gestionnaire.activerIndexRecherche();
+        gestionnaire.ouvrirStockage(instantane, journal);
+        Chronometre chrono;
+        executer(gestionnaire);
+        gestionnaire.synchroniser();
+        return 2.0 * static_cast<double>(nbTaches) / chrono.secondes();
+    };
+
+    const double uneParUne = mesurer([&](GestionnaireTaches& gestionnaire) {
+        std::istringstream entree(script);
+        std::string ligne;
+        while (std::getline(entree, ligne)) {
+            const auto premier = ligne.find('\t');
+            const auto second = ligne.find('\t', premier + 1);
+            if (ligne.starts_with("ajouter")) {
+                const auto troisieme = ligne.find('\t', second + 1);
+                const auto id = gestionnaire.ajouterTache(
+                    std::string_view(ligne).substr(troisieme + 1), Priorite::Moyenne,
+                    std::string_view(ligne).substr(second + 1, troisieme - second - 1));
+                sortie << "ok\t" << *id << std::endl;
+            } else {
+                gestionnaire.changerStatut(std::stoi(ligne.substr(premier + 1)), Statut::Terminee);
+                sortie << "ok" << std::endl;
+            }
+        }
+    });
+    const double parLots = mesurer([&](GestionnaireTaches& gestionnaire) {
+        std::istringstream entree(script);
+        executerCommandes(gestionnaire, entree, sortie);
+    });
+
+    std::cout << 2 * nbTaches << " commandes (journal) : une par une " << uneParUne / 1e6
+              << " M/s, executerCommandes " << parLots / 1e6 << " M/s (x" << parLots / uneParUne
+              << ")\n";
+    std::filesystem::remove(instantane);
+    std::filesystem::remove(journal);
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_commandes.cpp -o bench_commandes
+ * ./bench_commandes [nbTaches]
+ */
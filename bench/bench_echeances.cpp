@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+#include "commun.hpp"
+
+// echeancesEntre / enRetard : recherche dans la vue triée par date
+// (O(log n) + taille du résultat) contre parcours de la colonne des dates.
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2'000'000;
+
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    const DateCompacte jour = *dateDepuisTexte("2025-03-14");
+    const DateCompacte semaine = *dateDepuisTexte("2025-03-20");
+
+    auto mesurer = [&gestionnaire](auto&& requete, std::size_t& trouvees) {
+        std::size_t repetitions = 0;
+        Chronometre duree;
+        do {
+            trouvees = requete().size();
+            ++repetitions;
+        } while (duree.secondes() < 0.2);
+        return duree.secondes() / static_cast<double>(repetitions);
+    };
+    auto unJour = [&] { return gestionnaire.echeancesEntre(jour, jour); };
+    auto uneSemaine = [&] { return gestionnaire.echeancesEntre(jour, semaine); };
+    auto retard = [&] { return gestionnaire.enRetard(*dateDepuisTexte("2025-01-05")); };
+
+    std::size_t nbJour = 0;
+    std::size_t nbSemaine = 0;
+    std::size_t nbRetard = 0;
+    const double jourParcours = mesurer(unJour, nbJour);
+    const double semaineParcours = mesurer(uneSemaine, nbSemaine);
+    const double retardParcours = mesurer(retard, nbRetard);
+    gestionnaire.activerVuesTriees();
+    const double jourVue = mesurer(unJour, nbJour);
+    const double semaineVue = mesurer(uneSemaine, nbSemaine);
+    const double retardVue = mesurer(retard, nbRetard);
+
+    std::cout << nbTaches << " tâches\n"
+              << "  un jour (" << nbJour << ")        vue : " << jourVue * 1e3
+              << " ms, parcours : " << jourParcours * 1e3 << " ms\n"
+              << "  une semaine (" << nbSemaine << ") vue : " << semaineVue * 1e3
+              << " ms, parcours : " << semaineParcours * 1e3 << " ms\n"
+              << "  en retard (" << nbRetard << ")     vue : " << retardVue * 1e3
+              << " ms, parcours : " << retardParcours * 1e3 << " ms\n";
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_echeances.cpp -o bench_echeances
+ * ./bench_echeances [nbTaches]
+ */
@@ -0,0 +1,86 @@
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../projets/01-todo-app/magasin_partitionne.hpp"
+#include "commun.hpp"
+
+// Débit d'écriture selon le nombre de threads : chaque thread ajoute ses
+// tâches puis change leur statut. Un seul GestionnaireTaches derrière un
+// verrou contre MagasinPartitionne (une partition par thread).
+template <typename Ajouter, typename Changer>
+double ecrituresParSeconde(unsigned nbThreads, std::size_t nbTaches, Ajouter&& ajouter,
+                           Changer&& changer) {
+    Chronometre chrono;
+    {
+        std::vector<std::jthread> threads;
+        for (unsigned t = 0; t < nbThreads; ++t) {
+            threads.emplace_back([&, t] {
+                std::vector<int> ids;
+                ids.reserve(nbTaches / nbThreads);
+                std::string description = "tâche du fil " + std::to_string(t) + " n°";
+                const std::size_t prefixe = description.size();
+                for (std::size_t i = 0; i < nbTaches / nbThreads; ++i) {
+                    description.resize(prefixe);
+                    description += std::to_string(i);
+                    ids.push_back(ajouter(description));
+                }
+                for (const int id : ids) {
+                    changer(id);
+                }
+            });
+        }
+    }
+    return 2.0 * static_cast<double>(nbTaches) / chrono.secondes();
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2'000'000;
+    const unsigned maxThreads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                                         : nombreThreadsParDefaut();
+
+    std::cout << nbTaches << " ajouts + " << nbTaches << " changements de statut, "
+              << nombreThreadsParDefaut() << " coeurs\n";
+    double unVerrou = 0;
+    double unePartition = 0;
+    for (unsigned nbThreads = 1; nbThreads <= maxThreads; nbThreads *= 2) {
+        GestionnaireTaches gestionnaire;
+        std::mutex verrou;
+        const double avecVerrou = ecrituresParSeconde(
+            nbThreads, nbTaches,
+            [&](const std::string& description) {
+                std::lock_guard garde(verrou);
+                return *gestionnaire.ajouterTache(description, Priorite::Moyenne, "2025-06-01");
+            },
+            [&](int id) {
+                std::lock_guard garde(verrou);
+                gestionnaire.changerStatut(id, Statut::Terminee);
+            });
+
+        MagasinPartitionne magasin(nbThreads);
+        const double partitionne = ecrituresParSeconde(
+            nbThreads, nbTaches,
+            [&](const std::string& description) {
+                return *magasin.ajouterTache(description, Priorite::Moyenne, "2025-06-01");
+            },
+            [&](int id) { magasin.changerStatut(id, Statut::Terminee); });
+
+        if (nbThreads == 1) {
+            unVerrou = avecVerrou;
+            unePartition = partitionne;
+        }
+        std::cout << "  " << nbThreads << " thread(s) : verrou global " << avecVerrou / 1e6
+                  << " M écritures/s (x" << avecVerrou / unVerrou << "), partitionné "
+                  << partitionne / 1e6 << " M/s (x" << partitionne / unePartition << ")\n";
+    }
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_ecriture_partitionnee.cpp -o bench_ecriture_partitionnee
+ * ./bench_ecriture_partitionnee [nbTaches] [maxThreads]
+ */
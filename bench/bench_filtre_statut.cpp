@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "commun.hpp"
+
+// filtrerParStatut et compterParStatut avec chaque version du noyau
+// (scalaire, SSE2, AVX2), comparés à l'ancien filtre qui recopiait les
+// tâches retenues dans un std::vector.
+template <typename Essai>
+double meilleurDe5(Essai&& essai) {
+    double meilleur = 1e300;
+    for (int i = 0; i < 5; ++i) {
+        Chronometre chrono;
+        essai();
+        meilleur = std::min(meilleur, chrono.secondes());
+    }
+    return meilleur;
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5'000'000;
+
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    for (int id = 1; id <= static_cast<int>(nbTaches); id += 5) {
+        gestionnaire.changerStatut(id, Statut::EnCours);
+    }
+    const auto aos = copierTaches(gestionnaire);
+    const auto& statuts = gestionnaire.table().colonnes().statuts;
+    const double go = static_cast<double>(statuts.size()) / 1e9;
+
+    std::size_t nbCopies = 0;
+    const double dureeCopie = meilleurDe5([&] {
+        std::vector<TacheAoS> resultat;
+        for (const auto& t : aos) {
+            if (t.statut == Statut::EnCours) {
+                resultat.push_back(t);
+            }
+        }
+        nbCopies = resultat.size();
+    });
+    std::cout << nbTaches << " tâches, " << nbCopies << " en cours\n"
+              << "  ancien filtre (copies)       : " << dureeCopie * 1e3 << " ms\n";
+
+    const std::pair<simd::Jeu, const char*> jeux[] = {
+        {simd::Jeu::Scalaire, "scalaire"}, {simd::Jeu::SSE2, "SSE2"}, {simd::Jeu::AVX2, "AVX2"}};
+    for (const auto& [jeu, nom] : jeux) {
+        if (jeu > simd::jeuDisponible()) {
+            continue;
+        }
+        simd::Selection selection;
+        const double dureeFiltre = meilleurDe5([&] {
+            selection = simd::selectionnerEgal(statuts.data(), statuts.size(), 1, jeu);
+        });
+        std::array<std::size_t, 3> comptes{};
+        const double dureeComptes = meilleurDe5([&] {
+            comptes = simd::compterValeurs<3>(statuts.data(), statuts.size(), 0, jeu);
+        });
+        std::cout << "  " << nom << "\n"
+                  << "    filtre (sélection)         : " << dureeFiltre * 1e3 << " ms, "
+                  << go / dureeFiltre << " Go/s (" << selection.size() << " lignes)\n"
+                  << "    compterParStatut           : " << dureeComptes * 1e3 << " ms, "
+                  << go / dureeComptes << " Go/s (" << comptes[0] << '/' << comptes[1] << '/'
+                  << comptes[2] << ")\n";
+    }
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_filtre_statut.cpp -o bench_filtre_statut
+ * ./bench_filtre_statut [nbTaches]
+ */
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "commun.hpp"
+
+// Mesure changerStatut / supprimerTache avec l'index id -> case, et compare
+// à l'ancienne recherche linéaire (find_if sur tout le vecteur).
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500'000;
+    const std::size_t nbMisesAJour = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1'000'000;
+
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+
+    std::mt19937 generateur(7);
+    std::uniform_int_distribution<int> id(1, static_cast<int>(nbTaches));
+    std::uniform_int_distribution<int> statut(0, 2);
+
+    Chronometre chrono;
+    std::size_t trouvees = 0;
+    for (std::size_t i = 0; i < nbMisesAJour; ++i) {
+        trouvees += gestionnaire.changerStatut(id(generateur), static_cast<Statut>(statut(generateur)));
+    }
+    const double dureeIndex = chrono.secondes();
+
+    // Référence linéaire : sur un échantillon, la version complète serait quadratique.
+    const std::size_t echantillon = std::min<std::size_t>(nbMisesAJour, 2'000);
+    std::vector<TacheAoS> lineaire;
+    lineaire.reserve(nbTaches);
+    for (std::size_t i = 0; i < nbTaches; ++i) {
+        lineaire.push_back({static_cast<int>(i + 1), "", Statut::AFaire, Priorite::Moyenne, ""});
+    }
+    chrono.redemarrer();
+    for (std::size_t i = 0; i < echantillon; ++i) {
+        const int cible = id(generateur);
+        auto it = std::find_if(lineaire.begin(), lineaire.end(),
+                               [cible](const TacheAoS& t) { return t.id == cible; });
+        if (it != lineaire.end()) {
+            it->statut = static_cast<Statut>(statut(generateur));
+        }
+    }
+    const double dureeLineaire = chrono.secondes() / static_cast<double>(echantillon) *
+                                 static_cast<double>(nbMisesAJour);
+
+    std::vector<int> ids(nbTaches);
+    for (std::size_t i = 0; i < nbTaches; ++i) {
+        ids[i] = static_cast<int>(i + 1);
+    }
+    std::shuffle(ids.begin(), ids.end(), generateur);
+    chrono.redemarrer();
+    for (std::size_t i = 0; i < nbTaches / 2; ++i) {
+        gestionnaire.supprimerTache(ids[i]);
+    }
+    const double dureeSuppression = chrono.secondes();
+
+    std::cout << nbMisesAJour << " changerStatut sur " << nbTaches << " tâches ("
+              << trouvees << " trouvées)\n"
+              << "  index id -> case   : " << dureeIndex << " s\n"
+              << "  recherche linéaire : ~" << dureeLineaire << " s (extrapolé sur "
+              << echantillon << " appels)\n"
+              << nbTaches / 2 << " supprimerTache : " << dureeSuppression << " s, reste "
+              << gestionnaire.taille() << " tâches\n";
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_index_taches.cpp -o bench_index_taches
+ * ./bench_index_taches [nbTaches] [nbMisesAJour]
+ */
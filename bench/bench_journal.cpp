@@ -0,0 +1,54 @@
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+
+#include "commun.hpp"
+
+// Coût d'une sauvegarde : réécriture complète du CSV contre synchronisation
+// du journal après k modifications.
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+    const auto dossier = std::filesystem::temp_directory_path();
+    const auto fichierCSV = dossier / "bench_journal.csv";
+    const auto fichierInstantane = dossier / "bench_journal.bin";
+    const auto fichierJournal = dossier / "bench_journal.journal";
+    std::filesystem::remove(fichierInstantane);
+    std::filesystem::remove(fichierJournal);
+
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+
+    Chronometre chrono;
+    gestionnaire.sauvegarderCSV(fichierCSV);
+    std::cout << nbTaches << " tâches\n"
+              << "  sauvegarderCSV complet      : " << chrono.secondes() * 1e3 << " ms\n";
+
+    gestionnaire.ouvrirStockage(fichierInstantane, fichierJournal);
+    std::mt19937 generateur(3);
+    std::uniform_int_distribution<int> id(1, static_cast<int>(nbTaches));
+    for (const std::size_t nbModifications : {1, 100, 10'000}) {
+        chrono.redemarrer();
+        for (std::size_t i = 0; i < nbModifications; ++i) {
+            gestionnaire.changerStatut(id(generateur), Statut::EnCours);
+        }
+        gestionnaire.synchroniser();
+        std::cout << "  " << nbModifications << " modification(s) + synchroniser : "
+                  << chrono.secondes() * 1e3 << " ms\n";
+    }
+
+    chrono.redemarrer();
+    gestionnaire.consolider();
+    std::cout << "  consolider (nouvel instantané) : " << chrono.secondes() * 1e3 << " ms\n";
+
+    std::filesystem::remove(fichierCSV);
+    std::filesystem::remove(fichierInstantane);
+    std::filesystem::remove(fichierJournal);
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_journal.cpp -o bench_journal
+ * ./bench_journal [nbTaches]
+ */
@@ -0,0 +1,117 @@
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../projets/01-todo-app/magasin_concurrent.hpp"
+#include "commun.hpp"
+
+// Débit de lecture selon le nombre de threads lecteurs, pendant qu'un
+// écrivain applique sans arrêt des lots de changements de statut :
+// MagasinConcurrent (instantanés) contre GestionnaireTaches derrière un
+// verrou global. Une lecture = 16 recherches par id + un comptage par
+// statut, sur un même état.
+constexpr int recherchesParLecture = 16;
+constexpr double dureeMesure = 1.0;
+
+template <typename Lire, typename Ecrire>
+double lecturesParSeconde(unsigned nbLecteurs, Lire&& lire, Ecrire&& ecrire) {
+    std::atomic<bool> fini = false;
+    std::atomic<std::size_t> total = 0;
+    std::jthread ecrivain([&] {
+        std::mt19937 generateur(5);
+        while (!fini) {
+            ecrire(generateur);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    {
+        std::vector<std::jthread> lecteurs;
+        for (unsigned l = 0; l < nbLecteurs; ++l) {
+            lecteurs.emplace_back([&, l] {
+                std::mt19937 generateur(l);
+                std::size_t lectures = 0;
+                Chronometre chrono;
+                while (chrono.secondes() < dureeMesure) {
+                    lire(generateur);
+                    ++lectures;
+                }
+                total += lectures;
+            });
+        }
+    }
+    fini = true;
+    return static_cast<double>(total) / dureeMesure;
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+    const unsigned maxLecteurs = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+                                          : nombreThreadsParDefaut();
+
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    MagasinConcurrent magasin(gestionnaire);
+    std::mutex verrouGlobal;
+    std::uniform_int_distribution<int> id(1, static_cast<int>(nbTaches));
+    std::uniform_int_distribution<int> statut(0, 2);
+
+    // Lot de 64 changements de statut.
+    auto ecrireMagasin = [&](std::mt19937& generateur) {
+        LotTaches lot;
+        for (int k = 0; k < 64; ++k) {
+            lot.changerStatut(id(generateur), static_cast<Statut>(statut(generateur)));
+        }
+        magasin.appliquer(lot);
+    };
+    auto ecrireVerrou = [&](std::mt19937& generateur) {
+        std::lock_guard verrou(verrouGlobal);
+        for (int k = 0; k < 64; ++k) {
+            gestionnaire.changerStatut(id(generateur), static_cast<Statut>(statut(generateur)));
+        }
+    };
+    std::atomic<std::size_t> puits = 0;
+    auto lireMagasin = [&](std::mt19937& generateur) {
+        const auto version = magasin.instantane();
+        std::size_t trouvees = version->compterParStatut()[0];
+        for (int k = 0; k < recherchesParLecture; ++k) {
+            trouvees += version->trouver(id(generateur)).has_value();
+        }
+        puits.fetch_add(trouvees, std::memory_order_relaxed);
+    };
+    auto lireVerrou = [&](std::mt19937& generateur) {
+        std::lock_guard verrou(verrouGlobal);
+        std::size_t trouvees = gestionnaire.compterParStatut()[0];
+        for (int k = 0; k < recherchesParLecture; ++k) {
+            trouvees += gestionnaire.trouver(id(generateur)).has_value();
+        }
+        puits.fetch_add(trouvees, std::memory_order_relaxed);
+    };
+
+    std::cout << nbTaches << " tâches, " << nombreThreadsParDefaut()
+              << " coeurs, un écrivain (lots de 64 statuts toutes les ms)\n";
+    double unInstantane = 0;
+    double unVerrou = 0;
+    for (unsigned nbLecteurs = 1; nbLecteurs <= maxLecteurs; nbLecteurs *= 2) {
+        const double instantanes = lecturesParSeconde(nbLecteurs, lireMagasin, ecrireMagasin);
+        const double verrou = lecturesParSeconde(nbLecteurs, lireVerrou, ecrireVerrou);
+        if (nbLecteurs == 1) {
+            unInstantane = instantanes;
+            unVerrou = verrou;
+        }
+        std::cout << "  " << nbLecteurs << " lecteur(s) : instantanés " << instantanes / 1e3
+                  << " k lectures/s (x" << instantanes / unInstantane << "), verrou global "
+                  << verrou / 1e3 << " k/s (x" << verrou / unVerrou << ")\n";
+    }
+    return puits == 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_lecture_concurrente.cpp -o bench_lecture_concurrente
+ * ./bench_lecture_concurrente [nbTaches] [maxLecteurs]
+ */
@@ -0,0 +1,124 @@
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "commun.hpp"
+
+// Import de modifications : appels un par un contre un LotTaches appliqué
+// d'un bloc, avec l'index de recherche, les vues triées et (ou non) le
+// journal ouverts, comme dans la todo app.
+struct Modification {
+    enum Type { Ajout, Statut, Suppression } type;
+    int id;
+    std::string description;
+};
+
+std::vector<Modification> genererModifications(std::size_t nombre, std::size_t nbTaches) {
+    std::mt19937 generateur(7);
+    std::uniform_int_distribution<int> type(0, 3);
+    std::vector<int> ids(nbTaches);
+    for (std::size_t i = 0; i < nbTaches; ++i) {
+        ids[i] = static_cast<int>(i + 1);
+    }
+    std::shuffle(ids.begin(), ids.end(), generateur);
+    std::vector<Modification> modifications;
+    std::size_t suivant = 0;
+    for (std::size_t i = 0; i < nombre; ++i) {
+        // Une moitié d'ajouts ; statuts et suppressions visent des ids
+        // distincts, pour que les deux chemins restent valides.
+        const int t = type(generateur);
+        if (t < 2 || suivant == ids.size()) {
+            modifications.push_back({Modification::Ajout, 0, "importée n°" + std::to_string(i)});
+        } else {
+            modifications.push_back(
+                {t == 2 ? Modification::Statut : Modification::Suppression, ids[suivant++], {}});
+        }
+    }
+    return modifications;
+}
+
+double unParUn(GestionnaireTaches& gestionnaire, const std::vector<Modification>& modifications) {
+    Chronometre chrono;
+    for (const auto& m : modifications) {
+        switch (m.type) {
+            case Modification::Ajout:
+                gestionnaire.ajouterTache(m.description, Priorite::Moyenne, "2025-09-01");
+                break;
+            case Modification::Statut:
+                gestionnaire.changerStatut(m.id, Statut::Terminee);
+                break;
+            case Modification::Suppression:
+                gestionnaire.supprimerTache(m.id);
+                break;
+        }
+    }
+    gestionnaire.synchroniser();
+    return chrono.secondes();
+}
+
+double parLot(GestionnaireTaches& gestionnaire, const std::vector<Modification>& modifications) {
+    Chronometre chrono;
+    LotTaches lot;
+    for (const auto& m : modifications) {
+        switch (m.type) {
+            case Modification::Ajout:
+                lot.ajouter(m.description, Priorite::Moyenne, "2025-09-01");
+                break;
+            case Modification::Statut:
+                lot.changerStatut(m.id, Statut::Terminee);
+                break;
+            case Modification::Suppression:
+                lot.supprimer(m.id);
+                break;
+        }
+    }
+    if (!gestionnaire.appliquer(lot)) {
+        std::cerr << "lot refusé\n";
+    }
+    gestionnaire.synchroniser();
+    return chrono.secondes();
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+    const auto dossier = std::filesystem::temp_directory_path();
+    const auto instantane = dossier / "bench_lots.bin";
+    const auto journal = dossier / "bench_lots.journal";
+
+    std::cout << nbTaches << " tâches, index de recherche et vues triées actifs\n";
+    for (const bool journalise : {false, true}) {
+        for (const std::size_t nombre : {std::size_t{1'000}, nbTaches / 10, nbTaches}) {
+            const auto modifications = genererModifications(nombre, nbTaches);
+            double durees[2];
+            for (const bool lot : {false, true}) {
+                std::filesystem::remove(instantane);
+                std::filesystem::remove(journal);
+                GestionnaireTaches gestionnaire;
+                genererTaches(gestionnaire, nbTaches);
+                gestionnaire.activerIndexRecherche();
+                gestionnaire.activerVuesTriees();
+                if (journalise) {
+                    gestionnaire.ouvrirStockage(instantane, journal);
+                }
+                durees[lot] = lot ? parLot(gestionnaire, modifications)
+                                  : unParUn(gestionnaire, modifications);
+            }
+            std::cout << "  " << (journalise ? "journal, " : "mémoire, ") << nombre
+                      << " modifications : un par un " << durees[0] * 1e3 << " ms, lot "
+                      << durees[1] * 1e3 << " ms (" << nombre / durees[1] / 1e6 << " M/s, x"
+                      << durees[0] / durees[1] << ")\n";
+        }
+    }
+    std::filesystem::remove(instantane);
+    std::filesystem::remove(journal);
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_lots.cpp -o bench_lots
+ * ./bench_lots [nbTaches]
+ */
@@ -0,0 +1,122 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "commun.hpp"
+
+// Pic de mémoire (VmHWM, Linux ; il compte le CSV projeté pendant la
+// lecture), mémoire résidente une fois chargé et nombre d'allocations pour
+// charger le même CSV :
+//   aos     : un enregistrement par tâche, avec sa propre std::string
+//             (l'ancienne représentation) ;
+//   arene   : colonnes + descriptions dans l'arène ;
+//   interne : idem, descriptions identiques partagées.
+// Chaque mesure tourne dans son propre processus, pour que le pic de
+// mémoire de l'une ne masque pas celui des autres.
+
+namespace {
+std::size_t nbAllocations = 0;
+}
+
+void* operator new(std::size_t taille) {
+    ++nbAllocations;
+    if (void* p = std::malloc(taille == 0 ? 1 : taille)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+// GCC ne voit pas que ce `new` remplacé passe aussi par malloc.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Champ de /proc/self/status en Mo : VmHWM (pic), VmRSS (actuel).
+std::size_t memoireMo(const std::string& champ) {
+    std::ifstream statut("/proc/self/status");
+    std::string ligne;
+    while (std::getline(statut, ligne)) {
+        if (ligne.rfind(champ, 0) == 0) {
+            return std::strtoul(ligne.c_str() + champ.size(), nullptr, 10) / 1024;
+        }
+    }
+    return 0;
+}
+
+void chargerAoS(const std::filesystem::path& fichier, std::vector<TacheAoS>& taches) {
+    std::ifstream entree(fichier);
+    std::string ligne;
+    BilanChargement bilan;
+    while (std::getline(entree, ligne)) {
+        TableTaches une;
+        if (analyserLigneCSV(ligne, une, bilan)) {
+            taches.push_back(copierTache(une.ligne(0)));
+        }
+    }
+}
+
+int mesurer(const std::string& mode, const std::filesystem::path& fichier) {
+    const std::size_t allocationsAvant = nbAllocations;
+    std::size_t nbTaches = 0;
+    GestionnaireTaches gestionnaire;
+    std::vector<TacheAoS> taches;
+    if (mode == "aos") {
+        chargerAoS(fichier, taches);
+        nbTaches = taches.size();
+    } else {
+        if (mode == "interne") {
+            gestionnaire.activerInternement();
+        }
+        gestionnaire.chargerCSV(fichier);
+        nbTaches = gestionnaire.taille();
+    }
+    std::cout << "    " << mode << " : " << nbTaches << " tâches, pic " << memoireMo("VmHWM:")
+              << " Mo, chargé " << memoireMo("VmRSS:") << " Mo, "
+              << nbAllocations - allocationsAvant << " allocations\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 4 && std::string(argv[1]) == "--mesurer") {
+        return mesurer(argv[2], argv[3]);
+    }
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5'000'000;
+    const auto dossier = std::filesystem::temp_directory_path();
+
+    for (const bool numeroter : {true, false}) {
+        const auto fichier = dossier / "bench_memoire.csv";
+        {
+            GestionnaireTaches source;
+            genererTaches(source, nbTaches, 42, numeroter);
+            source.sauvegarderCSV(fichier);
+        }
+        std::cout << nbTaches << " tâches, descriptions "
+                  << (numeroter ? "toutes différentes" : "répétées") << " ("
+                  << std::filesystem::file_size(fichier) / 1'000'000 << " Mo de CSV)\n";
+        for (const char* mode : {"aos", "arene", "interne"}) {
+            std::cout.flush();
+            const std::string commande = std::string(argv[0]) + " --mesurer " + mode + " \"" +
+                                         fichier.string() + "\"";
+            if (std::system(commande.c_str()) != 0) {
+                std::cout << "    " << mode << " : échec\n";
+            }
+        }
+        std::filesystem::remove(fichier);
+    }
+    return 0;
+}
+
+/*
+ * Compilation et exécution (Linux pour le pic de mémoire) :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_memoire.cpp -o bench_memoire
+ * ./bench_memoire [nbTaches]
+ */
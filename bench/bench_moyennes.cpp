@@ -0,0 +1,69 @@
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../exemples/11-etudiants-csv.hpp"
+
+// Conversion seule de 5M moyennes : écriture par flux contre to_chars,
+// lecture par std::stod contre moyenneDepuisTexte (from_chars).
+int main() {
+    auto chronometrer = [](auto&& travail) {
+        const auto debut = std::chrono::steady_clock::now();
+        travail();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+    };
+
+    constexpr std::size_t nbValeurs = 5'000'000;
+    std::mt19937 generateur(7);
+    std::uniform_int_distribution<int> note(0, 2000);
+    std::vector<double> valeurs(nbValeurs);
+    for (auto& valeur : valeurs) {
+        valeur = note(generateur) / 100.0;
+    }
+    const double ecritureFlux = chronometrer([&] {
+        std::ostringstream flux;
+        for (const double valeur : valeurs) {
+            flux << valeur << '\n';
+        }
+    });
+    std::string tout;
+    const double ecritureToChars = chronometrer([&] {
+        char nombre[32];
+        for (const double valeur : valeurs) {
+            tout.append(nombre, std::to_chars(std::begin(nombre), std::end(nombre), valeur).ptr);
+            tout += '\n';
+        }
+    });
+    std::vector<std::string> textes;
+    for (std::size_t debut = 0; debut < tout.size();) {
+        const auto fin = tout.find('\n', debut);
+        textes.push_back(tout.substr(debut, fin - debut));
+        debut = fin + 1;
+    }
+    double somme = 0;
+    const double lectureStod = chronometrer([&] {
+        for (const auto& texte : textes) {
+            somme += std::stod(texte);
+        }
+    });
+    const double lectureFromChars = chronometrer([&] {
+        for (const auto& texte : textes) {
+            somme += *moyenneDepuisTexte(texte);
+        }
+    });
+    std::cout << nbValeurs / 1'000'000 << "M moyennes : écriture " << ecritureFlux
+              << " s (flux) contre " << ecritureToChars << " s (to_chars), lecture " << lectureStod
+              << " s (stod) contre " << lectureFromChars << " s (from_chars) [" << somme << "]\n";
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_moyennes.cpp -o bench_moyennes
+ * ./bench_moyennes
+ */
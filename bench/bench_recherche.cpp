@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "commun.hpp"
+
+// Latence de rechercherMotCle avec l'index des trigrammes, comparée au
+// parcours de toutes les descriptions, à 100k, 1M et 10M tâches.
+// Les motifs vont du très sélectif (un numéro) au très fréquent (un mot).
+int main(int argc, char* argv[]) {
+    const std::size_t maxTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000'000;
+    const char* const motifs[] = {"n°424242", "facture revue", "annexe", "rapport"};
+
+    for (const std::size_t nbTaches : {std::size_t{100'000}, std::size_t{1'000'000},
+                                       std::size_t{10'000'000}}) {
+        if (nbTaches > maxTaches) {
+            break;
+        }
+        GestionnaireTaches gestionnaire;
+        genererTaches(gestionnaire, nbTaches);
+        Chronometre chrono;
+        gestionnaire.activerIndexRecherche();
+        std::cout << nbTaches << " tâches (index construit en " << chrono.secondes() << " s)\n";
+
+        // Assez de répétitions pour mesurer aussi les requêtes rapides.
+        auto mesurer = [&gestionnaire](const char* motif, std::size_t& trouvees) {
+            std::size_t repetitions = 0;
+            Chronometre duree;
+            do {
+                trouvees = gestionnaire.rechercherMotCle(motif).size();
+                ++repetitions;
+            } while (duree.secondes() < 0.2);
+            return duree.secondes() / static_cast<double>(repetitions);
+        };
+        std::vector<double> index;
+        std::vector<std::size_t> trouveesIndex(std::size(motifs));
+        for (std::size_t m = 0; m < std::size(motifs); ++m) {
+            index.push_back(mesurer(motifs[m], trouveesIndex[m]));
+        }
+        gestionnaire.activerIndexRecherche(false);
+        for (std::size_t m = 0; m < std::size(motifs); ++m) {
+            std::size_t trouveesParcours = 0;
+            const double parcours = mesurer(motifs[m], trouveesParcours);
+            std::cout << "  \"" << motifs[m] << "\" : " << trouveesIndex[m] << " résultat(s)"
+                      << (trouveesIndex[m] == trouveesParcours ? "" : " DIFFÉRENTS") << "\n"
+                      << "    index    : " << index[m] * 1e3 << " ms\n"
+                      << "    parcours : " << parcours * 1e3 << " ms\n";
+        }
+    }
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_recherche.cpp -o bench_recherche
+ * ./bench_recherche [maxTaches]
+ */
@@ -0,0 +1,57 @@
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "commun.hpp"
+
+// Affichage de toutes les tâches : l'ancien afficherTache (std::setw champ
+// par champ, versTexte qui construisait une std::string) contre
+// RenduTaches. Puis listerTaches limité aux 20 premières, contre la liste
+// complète. La sortie part dans /dev/null : on mesure le formatage, pas le
+// terminal.
+void afficherAncien(std::ostream& sortie, const Tache& tache) {
+    sortie << "- [" << tache.id << "] " << std::setw(30) << std::left << tache.description << " | "
+           << std::setw(8) << std::string(versTexte(tache.statut)) << " | " << std::setw(7)
+           << std::string(versTexte(tache.priorite)) << " | " << dateVersTexte(tache.dateEcheance)
+           << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    std::ofstream sortie("/dev/null");
+
+    Chronometre chrono;
+    gestionnaire.pourChaqueTache([&sortie](const Tache& t) { afficherAncien(sortie, t); });
+    const double ancien = chrono.secondes();
+    chrono.redemarrer();
+    {
+        RenduTaches rendu(sortie);
+        gestionnaire.pourChaqueTache([&rendu](const Tache& t) { rendu.ajouter(t); });
+    }
+    const double tampon = chrono.secondes();
+    std::cout << nbTaches << " tâches affichées : setw " << ancien * 1e3 << " ms, RenduTaches "
+              << tampon * 1e3 << " ms (x" << ancien / tampon << ")\n";
+
+    for (const bool vues : {false, true}) {
+        gestionnaire.activerVuesTriees(vues);
+        gestionnaire.trierParPriorite();
+        chrono.redemarrer();
+        gestionnaire.listerTaches(GestionnaireTaches::toutes, sortie);
+        const double complete = chrono.secondes();
+        chrono.redemarrer();
+        gestionnaire.listerTaches(20, sortie);
+        const double premieres = chrono.secondes();
+        std::cout << "  par priorité" << (vues ? ", vues triées" : ", sans vues") << " : liste complète "
+                  << complete * 1e3 << " ms, 20 premières " << premieres * 1e3 << " ms\n";
+    }
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_rendu.cpp -o bench_rendu
+ * ./bench_rendu [nbTaches]
+ */
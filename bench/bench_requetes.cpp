@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "commun.hpp"
+
+// Requête « HAUTE, EN_COURS, échéance dans la semaine, contenant deploy » :
+// appels successifs (filtrerParStatut, puis copies filtrées et
+// intersections avec echeancesEntre et rechercherMotCle) contre
+// executer(RequeteTaches), pour toute la réponse puis pour une première page
+// de 20 tâches. Sans rien, puis avec l'index des trigrammes et les vues.
+constexpr int repetitions = 5;
+
+template <typename Fonction>
+double mesurer(Fonction&& fonction) {
+    double meilleur = 1e9;
+    for (int r = 0; r < repetitions; ++r) {
+        Chronometre chrono;
+        fonction();
+        meilleur = std::min(meilleur, chrono.secondes());
+    }
+    return meilleur;
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    for (std::size_t id = 1; id <= nbTaches; id += 3) {
+        gestionnaire.changerStatut(static_cast<int>(id), Statut::EnCours);
+    }
+    const DateCompacte debut = *dateDepuisTexte("2025-06-02");
+    const DateCompacte fin = debut + 6;
+    const auto requete = RequeteTaches()
+                             .statut(Statut::EnCours)
+                             .priorite(Priorite::Haute)
+                             .echeanceEntre(debut, fin)
+                             .motCle("deploy");
+
+    auto enChaine = [&] {
+        const auto& c = gestionnaire.table().colonnes();
+        simd::Selection lignes;
+        for (const auto ligne : gestionnaire.filtrerParStatut(Statut::EnCours)) {
+            if (c.priorites[ligne] == static_cast<std::uint8_t>(Priorite::Haute)) {
+                lignes.push_back(ligne);
+            }
+        }
+        auto echeances = gestionnaire.echeancesEntre(debut, fin);
+        std::sort(echeances.begin(), echeances.end());
+        simd::Selection intersection;
+        std::set_intersection(lignes.begin(), lignes.end(), echeances.begin(), echeances.end(),
+                              std::back_inserter(intersection));
+        const auto trouvees = gestionnaire.rechercherMotCle("deploy");
+        lignes.clear();
+        std::set_intersection(intersection.begin(), intersection.end(), trouvees.begin(),
+                              trouvees.end(), std::back_inserter(lignes));
+        return lignes.size();
+    };
+    auto compter = [&](const RequeteTaches& r) {
+        std::size_t n = 0;
+        for (const Tache& t : gestionnaire.executer(r)) {
+            n += t.id > 0;
+        }
+        return n;
+    };
+
+    std::cout << nbTaches << " tâches, " << compter(requete) << " résultats\n";
+    for (const bool index : {false, true}) {
+        gestionnaire.activerIndexRecherche(index);
+        gestionnaire.activerVuesTriees(index);
+        const double chaine = mesurer(enChaine);
+        const double planifiee = mesurer([&] { compter(requete); });
+        const double page = mesurer([&] { compter(RequeteTaches(requete).limiter(20)); });
+        std::cout << (index ? "  index et vues" : "  sans index ni vues") << " (plan "
+                  << gestionnaire.planifier(requete).expliquer() << ") : appels enchaînés "
+                  << chaine * 1e3 << " ms, executer " << planifiee * 1e3 << " ms (x"
+                  << chaine / planifiee << "), première page " << page * 1e3 << " ms\n";
+    }
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_requetes.cpp -o bench_requetes
+ * ./bench_requetes [nbTaches]
+ */
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "commun.hpp"
+#if defined(__linux__)
+#include "../projets/01-todo-app/client_taches.hpp"
+#endif
+
+// Requêtes/s et latences du serveur selon le nombre de clients et la
+// profondeur de pipelining. Une requête sur 16 demande les 10 premières
+// tâches par priorité, les autres changent un statut. La latence d'une
+// requête va de l'envoi de son paquet à la réception de sa réponse.
+// En référence : ce que payait chaque processus avant, un chargerCSV
+// complet, contre une liste complète demandée au serveur.
+constexpr double dureeMesure = 1.0;
+
+#if !defined(__linux__)
+int main() {
+    std::cerr << "bench_serveur : le serveur de tâches n'existe que sous Linux.\n";
+    return 1;
+}
+#else
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100'000;
+    const auto dossier = std::filesystem::temp_directory_path();
+    const auto chemin = dossier / "bench_serveur.sock";
+    const auto fichierCSV = dossier / "bench_serveur.csv";
+
+    GestionnaireTaches gestionnaire;
+    gestionnaire.activerVuesTriees();
+    genererTaches(gestionnaire, nbTaches);
+    gestionnaire.sauvegarderCSV(fichierCSV);
+    ServeurTaches serveur(gestionnaire);
+    if (!serveur.ecouter(chemin)) {
+        std::cerr << "Impossible d'écouter sur " << chemin << "\n";
+        return 1;
+    }
+    std::jthread boucle([&serveur] { serveur.servir(); });
+
+    Chronometre chrono;
+    GestionnaireTaches relu;
+    relu.chargerCSV(fichierCSV);
+    const double csv = chrono.secondes();
+    ClientTaches client;
+    client.connecter(chemin);
+    chrono.redemarrer();
+    const auto liste = client.lister(Ordre::Insertion);
+    const double parServeur = chrono.secondes();
+    std::cout << nbTaches << " tâches : chargerCSV " << csv * 1e3
+              << " ms, liste complète par le serveur " << parServeur * 1e3 << " ms ("
+              << (liste ? liste->size() : 0) << " tâches)\n";
+
+    for (const unsigned nbClients : {1u, 16u, 64u}) {
+        for (const unsigned profondeur : {1u, 32u}) {
+            std::mutex verrou;
+            std::vector<double> latences;
+            std::atomic<std::size_t> total = 0;
+            {
+                std::vector<std::jthread> clients;
+                for (unsigned c = 0; c < nbClients; ++c) {
+                    clients.emplace_back([&, c] {
+                        ClientTaches local;
+                        local.connecter(chemin);
+                        std::mt19937 generateur(c);
+                        std::uniform_int_distribution<int> id(1, static_cast<int>(nbTaches));
+                        std::vector<double> mesures;
+                        std::size_t requetes = 0;
+                        Chronometre duree;
+                        while (duree.secondes() < dureeMesure) {
+                            for (unsigned k = 0; k < profondeur; ++k) {
+                                if ((requetes + k) % 16 == 0) {
+                                    local.demanderListe(Ordre::Priorite, 10);
+                                } else {
+                                    local.demanderStatut(id(generateur), Statut::EnCours);
+                                }
+                            }
+                            const auto envoi = std::chrono::steady_clock::now();
+                            local.envoyer();
+                            for (unsigned k = 0; k < profondeur; ++k) {
+                                local.recevoir();
+                                mesures.push_back(std::chrono::duration<double>(
+                                                      std::chrono::steady_clock::now() - envoi)
+                                                      .count());
+                            }
+                            requetes += profondeur;
+                        }
+                        total += requetes;
+                        std::lock_guard garde(verrou);
+                        latences.insert(latences.end(), mesures.begin(), mesures.end());
+                    });
+                }
+            }
+            std::sort(latences.begin(), latences.end());
+            auto centile = [&latences](double p) {
+                const auto rang = p * static_cast<double>(latences.size() - 1);
+                return latences[static_cast<std::size_t>(rang)];
+            };
+            std::cout << "  " << nbClients << " client(s), " << profondeur << " requête(s) en vol : "
+                      << static_cast<double>(total) / dureeMesure / 1e3 << " k req/s, p50 "
+                      << centile(0.5) * 1e6 << " µs, p99 " << centile(0.99) * 1e6 << " µs\n";
+        }
+    }
+
+    serveur.arreter();
+    boucle.join();
+    std::filesystem::remove(fichierCSV);
+    return 0;
+}
+#endif
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_serveur.cpp -o bench_serveur
+ * ./bench_serveur [nbTaches]
+ */
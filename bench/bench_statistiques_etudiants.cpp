@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+#define EXEMPLE_SANS_MAIN
+#include "../exemples/07-gestion-etudiants.cpp"
+
+// Statistiques de `nombre` étudiants (10 millions par défaut), par
+// pointeurs (GestionnaireEtudiants) puis par colonnes (TableEtudiants),
+// dans l'ordre d'insertion puis après un tri par nom.
+int main(int argc, char* argv[]) {
+    const std::size_t nombre = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000'000;
+    auto chronometrer = [](auto&& travail) {
+        const auto debut = std::chrono::steady_clock::now();
+        travail();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+    };
+
+    GestionnaireEtudiants gestionnaire;
+    TableEtudiants table;
+    std::mt19937 generateur(42);
+    std::uniform_int_distribution<int> note(0, 2000);
+    std::uniform_int_distribution<int> age(17, 30);
+    std::uniform_int_distribution<unsigned> numero;
+    for (std::size_t i = 0; i < nombre; ++i) {
+        const std::string nom = "E" + std::to_string(numero(generateur));
+        const int a = age(generateur);
+        const double m = note(generateur) / 100.0;
+        gestionnaire.ajouterEtudiant(std::make_unique<Etudiant>(nom, a, m));
+        table.ajouterEtudiant(nom, a, m);
+    }
+
+    StatistiquesEtudiants parPointeurs, parColonnes;
+    auto mesurer = [&](const char* titre) {
+        constexpr int repetitions = 5;
+        double pointeurs = 1e9, colonnes = 1e9;
+        for (int r = 0; r < repetitions; ++r) {
+            pointeurs = std::min(pointeurs, chronometrer([&] {
+                parPointeurs = gestionnaire.calculerStatistiques();
+            }));
+            colonnes = std::min(colonnes, chronometrer([&] { parColonnes = table.statistiques(); }));
+        }
+        std::cout << titre << " : pointeurs " << pointeurs * 1e3 << " ms, colonnes "
+                  << colonnes * 1e3 << " ms (x" << pointeurs / colonnes << ") [moyennes "
+                  << parPointeurs.moyenne << " / " << parColonnes.moyenne << "]\n";
+    };
+
+    std::cout << nombre << " étudiants\n";
+    mesurer("Ordre d'insertion");
+    // Après un tri, les pointeurs ne suivent plus l'ordre des allocations.
+    gestionnaire.trierParNom();
+    table.trierParNom();
+    mesurer("Après tri par nom");
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_statistiques_etudiants.cpp -o bench_statistiques_etudiants
+ * ./bench_statistiques_etudiants [nombre]
+ * (avec -O3 -march=native, la boucle des statistiques passe en instructions vectorielles)
+ */
@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "commun.hpp"
+
+// Suite de mesures des chemins chauds de la todo app, sur un magasin
+// synthétique (ProfilTaches). Chaque mesure est répétée après quelques
+// tours d'échauffement ; on garde min, médiane, p90, p99 et max. Les
+// résultats peuvent être écrits en JSON, une mesure par ligne, puis deux
+// fichiers comparés (--comparer) : de quoi repérer une régression entre
+// deux versions du code, sans réseau ni outil extérieur.
+
+struct Options {
+    ProfilTaches profil;
+    int echauffement = 2;
+    int repetitions = 10;
+    std::string seulement;    // ne lancer que les mesures dont le nom contient ce texte
+    std::string json;
+};
+
+struct Resultat {
+    std::string nom;
+    std::vector<double> durees;    // en secondes, triées
+
+    double centile(double p) const {
+        const double rang = p * static_cast<double>(durees.size() - 1);
+        const auto bas = static_cast<std::size_t>(rang);
+        const auto haut = std::min(bas + 1, durees.size() - 1);
+        return durees[bas] + (durees[haut] - durees[bas]) * (rang - static_cast<double>(bas));
+    }
+};
+
+class Suite {
+public:
+    explicit Suite(const Options& options) : options_(options) {}
+
+    // `preparer` (non mesuré) est appelé avant chaque tour, `mesure` est
+    // chronométrée.
+    template <typename Preparer, typename Mesure>
+    void mesurer(std::string nom, Preparer&& preparer, Mesure&& mesure) {
+        if (nom.find(options_.seulement) == std::string::npos) {
+            return;
+        }
+        Resultat resultat{std::move(nom), {}};
+        for (int tour = 0; tour < options_.echauffement + options_.repetitions; ++tour) {
+            preparer();
+            Chronometre chrono;
+            mesure();
+            if (tour >= options_.echauffement) {
+                resultat.durees.push_back(chrono.secondes());
+            }
+        }
+        std::sort(resultat.durees.begin(), resultat.durees.end());
+        std::cout << "  " << std::left << std::setw(34) << resultat.nom << std::right << std::fixed
+                  << std::setprecision(3) << " p50 " << std::setw(10) << resultat.centile(0.5) * 1e3
+                  << " ms   p99 " << std::setw(10) << resultat.centile(0.99) * 1e3 << " ms\n";
+        resultats_.push_back(std::move(resultat));
+    }
+    template <typename Mesure>
+    void mesurer(std::string nom, Mesure&& mesure) {
+        mesurer(std::move(nom), [] {}, std::forward<Mesure>(mesure));
+    }
+
+    bool ecrireJSON(const std::string& fichier) const {
+        std::ofstream sortie(fichier);
+        const auto& p = options_.profil;
+        sortie << std::setprecision(6) << "{\n  \"parametres\": {\"taches\": " << p.nombre
+               << ", \"longueurMin\": " << p.longueurMin << ", \"longueurMax\": " << p.longueurMax
+               << ", \"longueTraine\": " << (p.longueTraine ? "true" : "false") << ", \"statuts\": ["
+               << p.statuts[0] << ", " << p.statuts[1] << ", " << p.statuts[2]
+               << "], \"graine\": " << p.graine << ", \"echauffement\": " << options_.echauffement
+               << ", \"repetitions\": " << options_.repetitions << "},\n  \"resultats\": [\n";
+        for (std::size_t i = 0; i < resultats_.size(); ++i) {
+            const auto& r = resultats_[i];
+            sortie << "    {\"nom\": \"" << r.nom << "\", \"min_ms\": " << r.durees.front() * 1e3
+                   << ", \"p50_ms\": " << r.centile(0.5) * 1e3
+                   << ", \"p90_ms\": " << r.centile(0.9) * 1e3
+                   << ", \"p99_ms\": " << r.centile(0.99) * 1e3
+                   << ", \"max_ms\": " << r.durees.back() * 1e3 << "}"
+                   << (i + 1 < resultats_.size() ? "," : "") << "\n";
+        }
+        sortie << "  ]\n}\n";
+        return static_cast<bool>(sortie);
+    }
+
+private:
+    const Options& options_;
+    std::vector<Resultat> resultats_;
+};
+
+// Lit les médianes d'un fichier écrit par ecrireJSON (une mesure par ligne).
+std::map<std::string, double> lireMedianes(const std::string& fichier) {
+    std::map<std::string, double> medianes;
+    std::ifstream entree(fichier);
+    std::string ligne;
+    while (std::getline(entree, ligne)) {
+        const auto nom = ligne.find("\"nom\": \"");
+        const auto p50 = ligne.find("\"p50_ms\": ");
+        if (nom == std::string::npos || p50 == std::string::npos) {
+            continue;
+        }
+        const auto debut = nom + 8;
+        medianes[ligne.substr(debut, ligne.find('"', debut) - debut)] =
+            std::strtod(ligne.c_str() + p50 + 10, nullptr);
+    }
+    return medianes;
+}
+
+// Médianes de `apres` rapportées à celles de `avant` ; au-delà de 10 %
+// d'écart, la mesure est signalée. Code de retour 1 si une mesure a ralenti.
+int comparer(const std::string& avant, const std::string& apres) {
+    const auto reference = lireMedianes(avant);
+    const auto nouvelles = lireMedianes(apres);
+    bool ralenti = false;
+    for (const auto& [nom, p50] : nouvelles) {
+        const auto it = reference.find(nom);
+        if (it == reference.end() || it->second <= 0) {
+            std::cout << "  " << std::left << std::setw(34) << nom << " (nouvelle mesure)\n";
+            continue;
+        }
+        const double rapport = p50 / it->second;
+        ralenti = ralenti || rapport > 1.10;
+        std::cout << "  " << std::left << std::setw(34) << nom << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << it->second << " -> " << std::setw(10)
+                  << p50 << " ms  x" << std::setprecision(2) << rapport;
+        if (rapport > 1.10) {
+            std::cout << "  plus lent";
+        } else if (rapport < 0.90) {
+            std::cout << "  plus rapide";
+        }
+        std::cout << "\n";
+    }
+    return ralenti ? 1 : 0;
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view option = argv[i];
+        const char* valeur = i + 1 < argc ? argv[i + 1] : "";
+        if (option == "--comparer" && i + 2 < argc) {
+            return comparer(argv[i + 1], argv[i + 2]);
+        }
+        if (option == "--longue-traine") {
+            options.profil.longueTraine = true;
+            continue;
+        }
+        ++i;
+        if (option == "--taches") {
+            options.profil.nombre = std::strtoul(valeur, nullptr, 10);
+        } else if (option == "--longueurs") {    // min-max
+            char* fin = nullptr;
+            options.profil.longueurMin = std::strtoul(valeur, &fin, 10);
+            options.profil.longueurMax =
+                std::max(options.profil.longueurMin, std::strtoul(*fin ? fin + 1 : fin, nullptr, 10));
+        } else if (option == "--statuts") {    // à faire,en cours,terminées
+            std::string texte = valeur;
+            char* fin = texte.data();
+            for (auto& part : options.profil.statuts) {
+                part = std::strtod(fin, &fin);
+                fin += *fin == ',';
+            }
+        } else if (option == "--graine") {
+            options.profil.graine = static_cast<unsigned>(std::strtoul(valeur, nullptr, 10));
+        } else if (option == "--echauffement") {
+            options.echauffement = std::atoi(valeur);
+        } else if (option == "--repetitions") {
+            options.repetitions = std::max(1, std::atoi(valeur));
+        } else if (option == "--seulement") {
+            options.seulement = valeur;
+        } else if (option == "--json") {
+            options.json = valeur;
+        } else {
+            std::cerr << "Option inconnue : " << option << "\n";
+            return 2;
+        }
+    }
+
+    const auto fichierCSV = std::filesystem::temp_directory_path() / "bench_suite.csv";
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, options.profil);
+    gestionnaire.sauvegarderCSV(fichierCSV);
+    std::cout << options.profil.nombre << " tâches, " << options.echauffement
+              << " tour(s) d'échauffement, " << options.repetitions << " mesure(s)\n";
+
+    Suite suite(options);
+    std::size_t controle = 0;
+    suite.mesurer("sauvegarderCSV", [&] { gestionnaire.sauvegarderCSV(fichierCSV); });
+    for (const auto mode : {ModeChargement::Flux, ModeChargement::Projection}) {
+        std::unique_ptr<GestionnaireTaches> relu;
+        suite.mesurer(
+            mode == ModeChargement::Flux ? "chargerCSV/flux" : "chargerCSV/projection",
+            [&] { relu = std::make_unique<GestionnaireTaches>(); },
+            [&] { relu->chargerCSV(fichierCSV, mode); });
+    }
+    suite.mesurer("filtrerParStatut",
+                  [&] { controle += gestionnaire.filtrerParStatut(Statut::EnCours).size(); });
+    suite.mesurer("compterParStatut", [&] { controle += gestionnaire.compterParStatut()[0]; });
+    for (const auto ordre : {Ordre::Priorite, Ordre::Date}) {
+        const std::string nom = ordre == Ordre::Priorite ? "priorite" : "date";
+        suite.mesurer("tri/" + nom, [&] {
+            gestionnaire.pourChaqueTache(ordre, [&](const Tache& t) { controle += t.id & 1; });
+        });
+        suite.mesurer("topK/" + nom, [&] { controle += gestionnaire.topK(20, ordre).size(); });
+    }
+    suite.mesurer("requete", [&] {
+        const auto requete =
+            RequeteTaches().statut(Statut::EnCours).priorite(Priorite::Haute).motCle("deploy");
+        for (const Tache& t : gestionnaire.executer(requete)) {
+            controle += t.id & 1;
+        }
+    });
+    suite.mesurer("rechercherMotCle/parcours",
+                  [&] { controle += gestionnaire.rechercherMotCle("facture").size(); });
+    gestionnaire.activerIndexRecherche();
+    suite.mesurer("rechercherMotCle/index",
+                  [&] { controle += gestionnaire.rechercherMotCle("facture").size(); });
+    gestionnaire.activerVuesTriees();
+    suite.mesurer("tri/priorite+vues", [&] {
+        gestionnaire.pourChaqueTache(Ordre::Priorite, [&](const Tache& t) { controle += t.id & 1; });
+    });
+
+    std::filesystem::remove(fichierCSV);
+    std::cout << "(contrôle " << controle << ")\n";
+    if (!options.json.empty() && !suite.ecrireJSON(options.json)) {
+        std::cerr << "Impossible d'écrire " << options.json << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_suite.cpp -o bench_suite
+ * ./bench_suite [--taches N] [--longueurs MIN-MAX] [--longue-traine] [--statuts A,B,C]
+ *               [--graine G] [--echauffement W] [--repetitions R] [--seulement TEXTE]
+ *               [--json resultats.json]
+ * ./bench_suite --comparer avant.json apres.json
+ */
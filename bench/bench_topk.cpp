@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "commun.hpp"
+
+// Les 20 tâches ouvertes les plus prioritaires : tri complet des lignes
+// (ce que coûtait trierParPriorite avant les vues), std::partial_sort des
+// lignes ouvertes, puis topK (tas borné) sur 1 thread et sur tous les
+// threads, et enfin topK avec les vues triées.
+constexpr std::size_t k = 20;
+
+template <typename Fonction>
+double mesurer(Fonction&& fonction) {
+    double meilleur = 1e9;
+    for (int r = 0; r < 3; ++r) {
+        Chronometre chrono;
+        fonction();
+        meilleur = std::min(meilleur, chrono.secondes());
+    }
+    return meilleur;
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10'000'000;
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    for (std::size_t id = 1; id <= nbTaches; id += 4) {
+        gestionnaire.changerStatut(static_cast<int>(id), Statut::Terminee);
+    }
+    const auto& c = gestionnaire.table().colonnes();
+    auto ouverte = [](const Tache& t) { return t.statut != Statut::Terminee; };
+    auto avant = [&c](std::size_t a, std::size_t b) {
+        return c.priorites[a] != c.priorites[b] ? c.priorites[a] > c.priorites[b] : c.ids[a] < c.ids[b];
+    };
+
+    std::size_t controle = 0;
+    const double triComplet = mesurer([&] {
+        std::vector<std::size_t> lignes(gestionnaire.table().nbLignes());
+        for (std::size_t i = 0; i < lignes.size(); ++i) {
+            lignes[i] = i;
+        }
+        std::sort(lignes.begin(), lignes.end(), avant);
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < lignes.size() && n < k; ++i) {
+            n += c.statuts[lignes[i]] != static_cast<std::uint8_t>(Statut::Terminee);
+        }
+        controle += n;
+    });
+    const double partiel = mesurer([&] {
+        std::vector<std::size_t> lignes;
+        for (std::size_t i = 0; i < gestionnaire.table().nbLignes(); ++i) {
+            if (c.statuts[i] != static_cast<std::uint8_t>(Statut::Terminee)) {
+                lignes.push_back(i);
+            }
+        }
+        std::partial_sort(lignes.begin(), lignes.begin() + k, lignes.end(), avant);
+        controle += k;
+    });
+    const double tas = mesurer([&] { controle += gestionnaire.topK(k, Ordre::Priorite, ouverte).size(); });
+    const unsigned nbThreads = nombreThreadsParDefaut();
+    const double tasParallele = mesurer(
+        [&] { controle += gestionnaire.topK(k, Ordre::Priorite, ouverte, nbThreads).size(); });
+    gestionnaire.activerVuesTriees();
+    const double vues = mesurer([&] { controle += gestionnaire.topK(k, Ordre::Priorite, ouverte).size(); });
+
+    std::cout << nbTaches << " tâches, " << k << " premières ouvertes par priorité (contrôle " << controle
+              << ") :\n  tri complet " << triComplet * 1e3 << " ms\n  partial_sort " << partiel * 1e3
+              << " ms\n  topK " << tas * 1e3 << " ms (x" << triComplet / tas << ")\n  topK, "
+              << nbThreads << " thread(s) " << tasParallele * 1e3 << " ms\n  topK avec vues "
+              << vues * 1e3 << " ms\n";
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_topk.cpp -o bench_topk
+ * ./bench_topk [nbTaches]
+ */
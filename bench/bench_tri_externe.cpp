@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../exemples/11-etudiants-csv.hpp"
+
+// Pic de mémoire du processus (Linux), en Mo ; 0 si inconnu.
+double picMemoireMo() {
+    std::ifstream statut("/proc/self/status");
+    std::string ligne;
+    while (std::getline(statut, ligne)) {
+        if (ligne.starts_with("VmHWM:")) {
+            return std::stod(ligne.substr(6)) / 1024;
+        }
+    }
+    return 0;
+}
+
+// Tri d'un fichier dix fois plus gros que le budget (8 Mo par défaut), en
+// externe (1 thread puis tous), puis en mémoire ; ensuite, écriture de tout
+// le fichier sur place contre sauvegarde atomique.
+int main(int argc, char* argv[]) {
+    const std::size_t budgetMo = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 8;
+    auto chronometrer = [](auto&& travail) {
+        const auto debut = std::chrono::steady_clock::now();
+        travail();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+    };
+
+    const auto dossier = std::filesystem::temp_directory_path();
+    const auto entree = dossier / "bench_etudiants.csv";
+    const auto sortieExterne = dossier / "bench_etudiants_externe.csv";
+    const auto sortieMemoire = dossier / "bench_etudiants_memoire.csv";
+    const std::size_t budget = budgetMo * 1024 * 1024;
+    {
+        std::ofstream fichier(entree);
+        std::mt19937 generateur(42);
+        std::uniform_int_distribution<int> note(0, 2000);
+        for (std::size_t i = 0; static_cast<std::size_t>(fichier.tellp()) < 10 * budget; ++i) {
+            ecrireEtudiant(fichier, "Nom" + std::to_string(i), "Prenom" + std::to_string(i % 1000),
+                           note(generateur) / 100.0);
+        }
+    }
+    const auto tailleMo = static_cast<double>(std::filesystem::file_size(entree)) / (1024 * 1024);
+    std::cout << "Fichier de " << tailleMo << " Mo, budget " << budgetMo << " Mo\n";
+    OptionsTriExterne options;
+    options.budgetOctets = budget;
+    const unsigned nbThreads = options.nbThreads;
+    std::vector<unsigned> essais = {1};
+    if (nbThreads > 1) {
+        essais.push_back(nbThreads);
+    }
+    for (const unsigned threads : essais) {
+        options.nbThreads = threads;
+        const double secondes = chronometrer([&] { trierCSVExterne(entree, sortieExterne, options); });
+        std::cout << "  externe, " << threads << " thread(s) : " << secondes << " s (pic "
+                  << picMemoireMo() << " Mo)\n";
+    }
+    const double secondes = chronometrer([&] {
+        auto etudiants = chargerCSV(entree);
+        std::stable_sort(etudiants.begin(), etudiants.end(),
+                         [](const auto& a, const auto& b) { return a.moyenne > b.moyenne; });
+        sauvegarderCSV(sortieMemoire, etudiants);
+    });
+    std::cout << "  en mémoire : " << secondes << " s (pic " << picMemoireMo() << " Mo)\n";
+
+    // Écriture de tout le fichier : flux par défaut tronqué sur place (la
+    // version d'origine de sauvegarderCSV), puis sauvegarde atomique
+    // (tampon de 1 Mio, fsync, rename, deux générations en liens durs).
+    {
+        const auto etudiants = chargerCSV(entree);
+        const auto cible = dossier / "bench_etudiants_sauvegarde.csv";
+        const double surPlace = chronometrer([&] {
+            std::ofstream sortie(cible);
+            for (const auto& e : etudiants) {
+                ecrireEtudiant(sortie, e.nom, e.prenom, e.moyenne);
+            }
+        });
+        OptionsSauvegarde sauvegarde;
+        sauvegarde.generations = 2;
+        sauvegarde.dossierBackup = dossier / "bench_etudiants_backup";
+        const double atomique = chronometrer([&] { sauvegarderCSV(cible, etudiants, sauvegarde); });
+        std::cout << "  sauvegarde de " << tailleMo << " Mo : sur place " << tailleMo / surPlace
+                  << " Mo/s, atomique avec fsync " << tailleMo / atomique << " Mo/s\n";
+        std::filesystem::remove(cible);
+        std::filesystem::remove_all(sauvegarde.dossierBackup);
+    }
+
+    std::ifstream a(sortieExterne);
+    std::ifstream b(sortieMemoire);
+    const bool identiques = std::equal(std::istreambuf_iterator<char>(a), {},
+                                       std::istreambuf_iterator<char>(b), {});
+    std::cout << "  fichiers triés identiques : " << (identiques ? "oui" : "NON") << "\n";
+    for (const auto& fichier : {entree, sortieExterne, sortieMemoire}) {
+        std::filesystem::remove(fichier);
+    }
+    return identiques ? 0 : 1;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_tri_externe.cpp -o bench_tri_externe
+ * ./bench_tri_externe [budgetMo]
+ */
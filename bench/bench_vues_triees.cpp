@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "commun.hpp"
+
+// L'interface alterne entre la liste par priorité et la liste par date.
+// Compare un tri complet à chaque bascule (l'ancien trierParPriorite /
+// trierParDate) au parcours des vues triées, et mesure ce que coûte leur
+// mise à jour sur les ajouts et suppressions.
+int main(int argc, char* argv[]) {
+    const std::size_t nbTaches = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1'000'000;
+    const int nbBascules = 10;
+
+    GestionnaireTaches gestionnaire;
+    genererTaches(gestionnaire, nbTaches);
+    std::size_t somme = 0;
+    auto compter = [&somme](const Tache& t) { somme += static_cast<std::size_t>(t.id); };
+
+    Chronometre chrono;
+    for (int i = 0; i < nbBascules; ++i) {
+        gestionnaire.pourChaqueTache(i % 2 == 0 ? Ordre::Priorite : Ordre::Date, compter);
+    }
+    const double dureeTri = chrono.secondes() / nbBascules;
+
+    chrono.redemarrer();
+    gestionnaire.activerVuesTriees();
+    const double dureeConstruction = chrono.secondes();
+    chrono.redemarrer();
+    for (int i = 0; i < nbBascules; ++i) {
+        gestionnaire.pourChaqueTache(i % 2 == 0 ? Ordre::Priorite : Ordre::Date, compter);
+    }
+    const double dureeVues = chrono.secondes() / nbBascules;
+
+    // Ajouts puis suppressions, avec puis sans vues.
+    const std::size_t nbModifications = 200'000;
+    auto modifier = [&gestionnaire, nbModifications](unsigned graine) {
+        std::mt19937 generateur(graine);
+        std::uniform_int_distribution<int> priorite(1, 3);
+        Chronometre duree;
+        for (std::size_t i = 0; i < nbModifications; ++i) {
+            gestionnaire.ajouterTache("nouvelle tâche", static_cast<Priorite>(priorite(generateur)),
+                                      "2025-06-15");
+        }
+        std::uniform_int_distribution<int> id(1, static_cast<int>(gestionnaire.taille()));
+        for (std::size_t i = 0; i < nbModifications; ++i) {
+            gestionnaire.supprimerTache(id(generateur));
+        }
+        return duree.secondes() / (2.0 * static_cast<double>(nbModifications));
+    };
+    const double modificationAvecVues = modifier(1);
+    gestionnaire.activerVuesTriees(false);
+    const double modificationSansVues = modifier(2);
+
+    std::cout << nbTaches << " tâches (somme de contrôle " << somme << ")\n"
+              << "  liste triée, tri à chaque bascule : " << dureeTri * 1e3 << " ms\n"
+              << "  liste triée, parcours des vues    : " << dureeVues * 1e3 << " ms\n"
+              << "  construction des vues             : " << dureeConstruction * 1e3 << " ms\n"
+              << "  ajout / suppression sans vues     : " << modificationSansVues * 1e9 << " ns\n"
+              << "  ajout / suppression avec vues     : " << modificationAvecVues * 1e9 << " ns\n";
+    return 0;
+}
+
+/*
+ * Compilation et exécution :
+ * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 bench_vues_triees.cpp -o bench_vues_triees
+ * ./bench_vues_triees [nbTaches]
+ */
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../projets/01-todo-app/taches.hpp"
+
+// Outils partagés par les benchmarks de la todo app.
+
+class Chronometre {
+public:
+    double secondes() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - debut_).count();
+    }
+    void redemarrer() {
+        debut_ = std::chrono::steady_clock::now();
+    }
+
+private:
+    std::chrono::steady_clock::time_point debut_ = std::chrono::steady_clock::now();
+};
+
+// Une tâche comme elle était rangée avant le stockage en colonnes : un
+// enregistrement autonome avec ses deux std::string (array of structures).
+// Sert de référence aux benchmarks.
+struct TacheAoS {
+    int id;
+    std::string description;
+    Statut statut;
+    Priorite priorite;
+    std::string dateEcheance;
+
+    bool operator==(const TacheAoS&) const = default;
+};
+
+inline TacheAoS copierTache(const Tache& tache) {
+    return {tache.id, std::string(tache.description), tache.statut, tache.priorite,
+            dateVersTexte(tache.dateEcheance)};
+}
+
+inline std::vector<TacheAoS> copierTaches(const GestionnaireTaches& gestionnaire) {
+    std::vector<TacheAoS> taches;
+    taches.reserve(gestionnaire.taille());
+    gestionnaire.pourChaqueTache([&taches](const Tache& t) { taches.push_back(copierTache(t)); });
+    return taches;
+}
+
+// Remplit un gestionnaire avec `nombre` tâches synthétiques reproductibles.
+// Sans `numeroter`, les descriptions se répètent (64 combinaisons de mots).
+inline void genererTaches(GestionnaireTaches& gestionnaire, std::size_t nombre,
+                          unsigned graine = 42, bool numeroter = true) {
+    static const char* const mots[] = {"rapport", "deploy", "courses", "réunion",
+                                       "facture", "revue", "sauvegarde", "appel"};
+    std::mt19937 generateur(graine);
+    std::uniform_int_distribution<int> mot(0, 7);
+    std::uniform_int_distribution<int> priorite(1, 3);
+    std::uniform_int_distribution<int> jour(1, 28);
+    std::uniform_int_distribution<int> mois(1, 12);
+
+    for (std::size_t i = 0; i < nombre; ++i) {
+        std::string description = std::string(mots[mot(generateur)]) + ' ' + mots[mot(generateur)];
+        if (numeroter) {
+            description += " n°" + std::to_string(i);
+        }
+        if (i % 16 == 0) {
+            description += "; voir \"annexe\"";
+        }
+        char date[11];
+        std::snprintf(date, sizeof(date), "2025-%02d-%02d", mois(generateur), jour(generateur));
+        gestionnaire.ajouterTache(description, static_cast<Priorite>(priorite(generateur)), date);
+    }
+}
+
+// Magasin synthétique paramétrable, pour bench_suite : nombre de tâches,
+// longueur des descriptions (uniforme entre min et max, ou à longue traîne :
+// surtout des courtes, quelques très longues) et part de chaque statut.
+struct ProfilTaches {
+    std::size_t nombre = 200'000;
+    std::size_t longueurMin = 12;
+    std::size_t longueurMax = 80;
+    bool longueTraine = false;
+    std::array<double, 3> statuts = {0.5, 0.3, 0.2};    // à faire, en cours, terminées
+    unsigned graine = 42;
+};
+
+inline void genererTaches(GestionnaireTaches& gestionnaire, const ProfilTaches& profil) {
+    static const char* const mots[] = {"rapport", "deploy", "courses", "réunion",
+                                       "facture", "revue", "sauvegarde", "appel"};
+    std::mt19937 generateur(profil.graine);
+    std::uniform_int_distribution<int> mot(0, 7);
+    std::uniform_int_distribution<int> priorite(1, 3);
+    std::uniform_int_distribution<int> jour(1, 28);
+    std::uniform_int_distribution<int> mois(1, 12);
+    std::uniform_int_distribution<std::size_t> uniforme(profil.longueurMin, profil.longueurMax);
+    std::exponential_distribution<double> traine(
+        4.0 / static_cast<double>(std::max<std::size_t>(1, profil.longueurMax - profil.longueurMin)));
+    std::discrete_distribution<int> statut(profil.statuts.begin(), profil.statuts.end());
+
+    std::string description;
+    for (std::size_t i = 0; i < profil.nombre; ++i) {
+        std::size_t longueur = uniforme(generateur);
+        if (profil.longueTraine) {
+            longueur = std::min(profil.longueurMax,
+                                profil.longueurMin + static_cast<std::size_t>(traine(generateur)));
+        }
+        description = "n°" + std::to_string(i);
+        while (description.size() < longueur) {
+            description += ' ';
+            description += mots[mot(generateur)];
+        }
+        // Coupe à la longueur voulue sans couper un caractère UTF-8.
+        while (longueur > 1 && longueur < description.size() &&
+               (static_cast<unsigned char>(description[longueur]) & 0xC0) == 0x80) {
+            --longueur;
+        }
+        description.resize(std::min(std::max<std::size_t>(longueur, 1), description.size()));
+        char date[11];
+        std::snprintf(date, sizeof(date), "2025-%02d-%02d", mois(generateur), jour(generateur));
+        const auto id = gestionnaire.ajouterTache(description, static_cast<Priorite>(priorite(generateur)),
+                                                  date);
+        const auto s = static_cast<Statut>(statut(generateur));
+        if (id && s != Statut::AFaire) {
+            gestionnaire.changerStatut(*id, s);
+        }
+    }
+}
@@ -3,6 +3,12 @@
 #include <string>
 #include <memory>
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
 
 // Classe représentant un étudiant
 class Etudiant {
@@ -26,6 +32,130 @@ private:
     double moyenne_;
 };
 
+// Agrégats sur les moyennes (sur 20) et les âges. La tranche t regroupe
+// les moyennes de [4t, 4t + 4[, 20 compris dans la dernière.
+struct StatistiquesEtudiants {
+    static constexpr std::size_t nbTranches = 5;
+
+    std::size_t nombre = 0;
+    double moyenne = 0.0;
+    double variance = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    std::size_t indiceMin = 0;    // premier étudiant qui a la moyenne min
+    std::size_t indiceMax = 0;
+    double ageMoyen = 0.0;
+    std::array<std::size_t, nbTranches> parTranche{};
+};
+
+void afficherStatistiques(const StatistiquesEtudiants& s, const std::string& meilleur,
+                          const std::string& plusFaible) {
+    std::cout << "\n=== Statistiques ===\n";
+    std::cout << "Nombre d'étudiants: " << s.nombre << "\n";
+    std::cout << "Moyenne générale: " << s.moyenne << " (écart type " << std::sqrt(s.variance)
+              << ")\n";
+    std::cout << "Meilleur étudiant: " << meilleur << " (" << s.max << ")\n";
+    std::cout << "Plus faible moyenne: " << plusFaible << " (" << s.min << ")\n";
+    std::cout << "Âge moyen: " << s.ageMoyen << "\n";
+    std::cout << "Répartition:";
+    for (std::size_t t = 0; t < s.parTranche.size(); ++t) {
+        std::cout << " [" << 4 * t << "-" << 4 * t + 4 << (t + 1 < s.nbTranches ? "[" : "]")
+                  << " " << s.parTranche[t];
+    }
+    std::cout << "\n";
+}
+
+// Tous les agrégats en un seul passage sur des colonnes contiguës. Chaque
+// voie a ses propres accumulateurs et la boucle interne n'a ni branche ni
+// dépendance d'une voie à l'autre : le compilateur peut la vectoriser. Les
+// tranches se comptent par comparaisons (moyennes >= 4, >= 8...) plutôt
+// que par un histogramme indexé. Min et max sont d'abord pris par bloc ;
+// l'indice n'est cherché que dans un bloc qui améliore l'extremum, quand
+// il est encore dans le cache. Les écarts à un pivot (la première
+// moyenne) limitent les pertes de précision de somme et somme des carrés.
+StatistiquesEtudiants calculerStatistiques(std::span<const double> moyennes,
+                                           std::span<const int> ages) {
+    constexpr std::size_t voies = 4;
+    constexpr std::size_t bloc = 4096;
+    constexpr std::size_t nbSeuils = StatistiquesEtudiants::nbTranches - 1;
+
+    StatistiquesEtudiants s;
+    s.nombre = moyennes.size();
+    if (s.nombre == 0) {
+        return s;
+    }
+    s.min = std::numeric_limits<double>::infinity();
+    s.max = -s.min;
+    const double pivot = moyennes[0];
+    std::array<double, voies> sommes{}, carres{}, ecartsAges{};
+    std::array<std::array<double, nbSeuils>, voies> auDessus{};
+
+    for (std::size_t debut = 0; debut < s.nombre; debut += bloc) {
+        const std::size_t fin = std::min(debut + bloc, s.nombre);
+        std::array<double, voies> minis, maxis;
+        minis.fill(s.min);
+        maxis.fill(s.max);
+        auto accumuler = [&](std::size_t v, std::size_t i) {
+            const double x = moyennes[i];
+            const double ecart = x - pivot;
+            sommes[v] += ecart;
+            carres[v] += ecart * ecart;
+            ecartsAges[v] += ages[i] - ages[0];
+            minis[v] = std::min(minis[v], x);
+            maxis[v] = std::max(maxis[v], x);
+            for (std::size_t k = 0; k < nbSeuils; ++k) {
+                auDessus[v][k] += x >= 4.0 * static_cast<double>(k + 1);
+            }
+        };
+        std::size_t i = debut;
+        for (; i + voies <= fin; i += voies) {
+            for (std::size_t v = 0; v < voies; ++v) {
+                accumuler(v, i + v);
+            }
+        }
+        for (; i < fin; ++i) {
+            accumuler(0, i);
+        }
+
+        const auto premier = moyennes.begin() + static_cast<std::ptrdiff_t>(debut);
+        const auto dernier = moyennes.begin() + static_cast<std::ptrdiff_t>(fin);
+        const double miniBloc = *std::min_element(minis.begin(), minis.end());
+        const double maxiBloc = *std::max_element(maxis.begin(), maxis.end());
+        if (miniBloc < s.min) {
+            s.min = miniBloc;
+            s.indiceMin = static_cast<std::size_t>(std::find(premier, dernier, miniBloc) -
+                                                   moyennes.begin());
+        }
+        if (maxiBloc > s.max) {
+            s.max = maxiBloc;
+            s.indiceMax = static_cast<std::size_t>(std::find(premier, dernier, maxiBloc) -
+                                                   moyennes.begin());
+        }
+    }
+
+    const double n = static_cast<double>(s.nombre);
+    double somme = 0.0, sommeCarres = 0.0, sommeAges = 0.0;
+    std::array<double, nbSeuils> seuils{};
+    for (std::size_t v = 0; v < voies; ++v) {
+        somme += sommes[v];
+        sommeCarres += carres[v];
+        sommeAges += ecartsAges[v];
+        for (std::size_t k = 0; k < nbSeuils; ++k) {
+            seuils[k] += auDessus[v][k];
+        }
+    }
+    s.moyenne = pivot + somme / n;
+    s.variance = std::max(0.0, (sommeCarres - somme * somme / n) / n);
+    s.ageMoyen = ages[0] + sommeAges / n;
+    double precedent = n;
+    for (std::size_t k = 0; k < nbSeuils; ++k) {
+        s.parTranche[k] = static_cast<std::size_t>(precedent - seuils[k]);
+        precedent = seuils[k];
+    }
+    s.parTranche[nbSeuils] = static_cast<std::size_t>(precedent);
+    return s;
+}
+
 // Classe gestionnaire d'étudiants
 class GestionnaireEtudiants {
 public:
@@ -64,30 +194,129 @@ public:
         return somme / etudiants_.size();
     }
     
+    // Un passage par agrégat, et un pointeur suivi par étudiant à chaque
+    // passage : la version de référence de TableEtudiants::statistiques.
+    StatistiquesEtudiants calculerStatistiques() const {
+        StatistiquesEtudiants s;
+        s.nombre = etudiants_.size();
+        if (etudiants_.empty()) return s;
+        
+        auto parMoyenne = [](const auto& a, const auto& b) {
+            return a->getMoyenne() < b->getMoyenne();
+        };
+        auto plusFaible = std::min_element(etudiants_.begin(), etudiants_.end(), parMoyenne);
+        auto meilleur = std::max_element(etudiants_.begin(), etudiants_.end(), parMoyenne);
+        s.min = (*plusFaible)->getMoyenne();
+        s.max = (*meilleur)->getMoyenne();
+        s.indiceMin = static_cast<std::size_t>(plusFaible - etudiants_.begin());
+        s.indiceMax = static_cast<std::size_t>(meilleur - etudiants_.begin());
+        
+        s.moyenne = calculerMoyenneGenerale();
+        double ecarts = 0.0;
+        double ages = 0.0;
+        for (const auto& etudiant : etudiants_) {
+            const double ecart = etudiant->getMoyenne() - s.moyenne;
+            ecarts += ecart * ecart;
+        }
+        for (const auto& etudiant : etudiants_) {
+            ages += etudiant->getAge();
+        }
+        for (const auto& etudiant : etudiants_) {
+            const auto tranche = static_cast<std::size_t>(std::max(0.0, etudiant->getMoyenne() / 4));
+            ++s.parTranche[std::min(tranche, s.nbTranches - 1)];
+        }
+        s.variance = ecarts / etudiants_.size();
+        s.ageMoyen = ages / etudiants_.size();
+        return s;
+    }
+    
     void afficherStatistiques() const {
         if (etudiants_.empty()) {
             std::cout << "Aucun étudiant.\n";
             return;
         }
         
-        auto moyenneGenerale = calculerMoyenneGenerale();
-        
-        auto meilleur = std::max_element(etudiants_.begin(), etudiants_.end(),
-            [](const auto& a, const auto& b) {
-                return a->getMoyenne() < b->getMoyenne();
-            });
-        
-        std::cout << "\n=== Statistiques ===\n";
-        std::cout << "Nombre d'étudiants: " << etudiants_.size() << "\n";
-        std::cout << "Moyenne générale: " << moyenneGenerale << "\n";
-        std::cout << "Meilleur étudiant: " << (*meilleur)->getNom() 
-                  << " (" << (*meilleur)->getMoyenne() << ")\n";
+        const auto s = calculerStatistiques();
+        ::afficherStatistiques(s, etudiants_[s.indiceMax]->getNom(),
+                               etudiants_[s.indiceMin]->getNom());
     }
 
 private:
     std::vector<std::unique_ptr<Etudiant>> etudiants_;
 };
 
+// Les mêmes étudiants rangés par colonnes : toutes les moyennes à la
+// suite, tous les âges à la suite. Les statistiques ne lisent que ces
+// deux colonnes, sans jamais toucher aux noms.
+class TableEtudiants {
+public:
+    void ajouterEtudiant(std::string nom, int age, double moyenne) {
+        noms_.push_back(std::move(nom));
+        ages_.push_back(age);
+        moyennes_.push_back(moyenne);
+    }
+    
+    std::size_t taille() const { return noms_.size(); }
+    
+    void afficherTous() const {
+        std::cout << "\n=== Liste des étudiants ===\n";
+        for (std::size_t i = 0; i < taille(); ++i) {
+            std::cout << "Nom: " << noms_[i]
+                      << ", Age: " << ages_[i]
+                      << ", Moyenne: " << moyennes_[i] << "\n";
+        }
+    }
+    
+    void trierParMoyenne() {
+        reordonner([this](std::size_t a, std::size_t b) { return moyennes_[a] > moyennes_[b]; });
+    }
+    
+    void trierParNom() {
+        reordonner([this](std::size_t a, std::size_t b) { return noms_[a] < noms_[b]; });
+    }
+    
+    StatistiquesEtudiants statistiques() const {
+        return calculerStatistiques(moyennes_, ages_);
+    }
+    
+    void afficherStatistiques() const {
+        if (taille() == 0) {
+            std::cout << "Aucun étudiant.\n";
+            return;
+        }
+        
+        const auto s = statistiques();
+        ::afficherStatistiques(s, noms_[s.indiceMax], noms_[s.indiceMin]);
+    }
+
+private:
+    // Trie une permutation des lignes, puis l'applique à chaque colonne.
+    template <typename Comparer>
+    void reordonner(Comparer avant) {
+        std::vector<std::size_t> ordre(taille());
+        std::iota(ordre.begin(), ordre.end(), std::size_t{0});
+        std::sort(ordre.begin(), ordre.end(), avant);
+        auto permuter = [&ordre](auto& colonne) {
+            std::remove_reference_t<decltype(colonne)> triee;
+            triee.reserve(colonne.size());
+            for (const auto ligne : ordre) {
+                triee.push_back(std::move(colonne[ligne]));
+            }
+            colonne = std::move(triee);
+        };
+        permuter(noms_);
+        permuter(ages_);
+        permuter(moyennes_);
+    }
+    
+    std::vector<std::string> noms_;
+    std::vector<int> ages_;
+    std::vector<double> moyennes_;
+};
+
+// Les tests (tests/pedagogie) et bench/bench_statistiques_etudiants.cpp
+// incluent ce fichier sans son main.
+#if !defined(EXEMPLE_SANS_MAIN)
 int main() {
     // Créer un gestionnaire
     GestionnaireEtudiants gestionnaire;
@@ -112,6 +341,16 @@ int main() {
     // Afficher les statistiques
     gestionnaire.afficherStatistiques();
     
+    // Les mêmes étudiants rangés par colonnes : mêmes statistiques, calculées
+    // en un seul passage
+    TableEtudiants table;
+    table.ajouterEtudiant("Alice Dupont", 20, 15.5);
+    table.ajouterEtudiant("Bob Martin", 21, 12.3);
+    table.ajouterEtudiant("Charlie Durand", 19, 17.8);
+    table.ajouterEtudiant("Diana Lambert", 20, 14.2);
+    std::cout << "\n(mêmes étudiants, rangés par colonnes)";
+    table.afficherStatistiques();
+    
     // Trier par moyenne
     std::cout << "\n=== Triés par moyenne (décroissant) ===\n";
     gestionnaire.trierParMoyenne();
@@ -125,6 +364,7 @@ int main() {
     // Gestion automatique de la mémoire avec smart pointers !
     return 0;
 }
+#endif
 
 /*
  * Ce programme démontre :
@@ -135,6 +375,7 @@ int main() {
  * - Algorithmes STL (sort, max_element)
  * - Move semantics
  * - Const-correctness
+ * - Rangement par colonnes et agrégats en un seul passage (TableEtudiants)
  */
 
 /*
@@ -0,0 +1,502 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Le fichier CSV des étudiants (nom,prenom,moyenne) de l'exemple 11 :
+// conversion des moyennes, sauvegarde atomique, lecture en flux et tri
+// externe. L'exemple montre comment s'en servir ; les tests et les
+// benchmarks incluent ce fichier directement.
+
+struct Etudiant {
+    std::string nom;
+    std::string prenom;
+    double moyenne;
+};
+
+// --- Conversion des moyennes sans passer par les flux ---
+// std::to_chars écrit l'écriture la plus courte qui, relue par
+// std::from_chars, redonne exactement le même double (aller-retour exact) ;
+// ni l'un ni l'autre ne dépend de la locale ni n'alloue.
+
+// Accepte ce qu'acceptait std::stod : espaces initiaux, signe, notation
+// hexadécimale (0x), inf et nan ; les caractères qui suivent le nombre sont
+// ignorés. Rien si aucun nombre ne commence le texte ou s'il est hors de
+// portée (dépassement, ou trop petit pour un double normalisé).
+inline std::optional<double> moyenneDepuisTexte(std::string_view texte) {
+    std::size_t i = 0;
+    while (i < texte.size() && std::isspace(static_cast<unsigned char>(texte[i]))) {
+        ++i;
+    }
+    bool negatif = false;
+    if (i < texte.size() && (texte[i] == '+' || texte[i] == '-')) {
+        negatif = texte[i] == '-';
+        ++i;
+    }
+    const char* debut = texte.data() + i;
+    const char* fin = texte.data() + texte.size();
+    // from_chars accepte lui-même un '-' : un second signe est refusé ici.
+    if (debut == fin || *debut == '+' || *debut == '-') {
+        return std::nullopt;
+    }
+    double valeur = 0;
+    std::from_chars_result resultat{};
+    if (fin - debut >= 2 && debut[0] == '0' && (debut[1] == 'x' || debut[1] == 'X')) {
+        const bool chiffres = fin - debut > 2 &&
+                              (std::isxdigit(static_cast<unsigned char>(debut[2])) || debut[2] == '.');
+        // « 0x » sans chiffre derrière : seul le 0 est lu, comme strtod.
+        resultat = chiffres ? std::from_chars(debut + 2, fin, valeur, std::chars_format::hex)
+                            : std::from_chars(debut, debut + 1, valeur);
+    } else {
+        resultat = std::from_chars(debut, fin, valeur);
+    }
+    if (resultat.ec != std::errc{} ||
+        (valeur != 0 && std::fpclassify(valeur) == FP_SUBNORMAL)) {
+        return std::nullopt;
+    }
+    return negatif ? -valeur : valeur;
+}
+
+inline void ecrireEtudiant(std::ostream& sortie, std::string_view nom, std::string_view prenom,
+                           double moyenne) {
+    char nombre[32];
+    const auto fin = std::to_chars(std::begin(nombre), std::end(nombre), moyenne).ptr;
+    sortie << nom << ',' << prenom << ',';
+    sortie.write(nombre, fin - nombre);
+    sortie.put('\n');
+}
+
+// --- Sauvegarde atomique ---
+// Le fichier n'est jamais réécrit sur place : on écrit `fichier.tmp`, on
+// force son écriture sur disque (fsync), puis rename le met à la place de
+// l'ancien d'un seul coup. Une coupure laisse donc soit l'ancienne
+// version, soit la nouvelle, jamais un fichier à moitié écrit. Avant le
+// rename, l'ancienne version peut être gardée dans le dossier de backup :
+// un lien dur suffit (pas de copie), puisque rename ne modifie pas
+// l'ancien fichier mais fait pointer le nom sur le nouveau.
+
+struct OptionsSauvegarde {
+    std::size_t tailleTampon = 1 << 20;    // tampon d'écriture, 1 Mio
+    bool synchroniser = true;              // fsync avant le rename
+    int generations = 0;                   // anciennes versions gardées
+    std::filesystem::path dossierBackup = "backup";
+};
+
+// Force l'écriture sur disque d'un fichier fermé, ou d'un dossier (sous
+// POSIX, c'est ce qui rend un rename durable).
+inline void forcerSurDisque(const std::filesystem::path& chemin) {
+#if defined(_WIN32)
+    (void)chemin;
+#else
+    const int descripteur = ::open(chemin.c_str(), O_RDONLY);
+    const bool ok = descripteur >= 0 && ::fsync(descripteur) == 0;
+    if (descripteur >= 0) {
+        ::close(descripteur);
+    }
+    if (!ok) {
+        throw std::runtime_error("fsync impossible : " + chemin.string());
+    }
+#endif
+}
+
+// backup/etudiants.csv.1 est la version la plus récente, .N la plus
+// ancienne ; la version N est oubliée.
+inline void tournerSauvegardes(const std::filesystem::path& fichier,
+                               const OptionsSauvegarde& options) {
+    if (options.generations <= 0 || !std::filesystem::exists(fichier)) {
+        return;
+    }
+    std::filesystem::create_directories(options.dossierBackup);
+    auto generation = [&](int numero) {
+        return options.dossierBackup / (fichier.filename().string() + "." + std::to_string(numero));
+    };
+    std::filesystem::remove(generation(options.generations));
+    for (int numero = options.generations - 1; numero >= 1; --numero) {
+        if (std::filesystem::exists(generation(numero))) {
+            std::filesystem::rename(generation(numero), generation(numero + 1));
+        }
+    }
+    std::error_code erreur;
+    std::filesystem::create_hard_link(fichier, generation(1), erreur);
+    if (erreur) {
+        // Système de fichiers sans liens durs, ou backup sur un autre disque.
+        std::filesystem::copy_file(fichier, generation(1));
+    }
+}
+
+// Écrit `fichier` par `ecrire(flux)` selon le principe ci-dessus.
+template <typename Ecrire>
+void ecrireAtomique(const std::filesystem::path& fichier, const OptionsSauvegarde& options,
+                    Ecrire&& ecrire) {
+    auto temporaire = fichier;
+    temporaire += ".tmp";
+    try {
+        std::vector<char> tampon(options.tailleTampon);
+        std::ofstream sortie;
+        // Le tampon doit être installé avant l'ouverture.
+        sortie.rdbuf()->pubsetbuf(tampon.data(), static_cast<std::streamsize>(tampon.size()));
+        sortie.open(temporaire, std::ios::binary | std::ios::trunc);
+        if (!sortie) {
+            throw std::runtime_error("Impossible d'ouvrir le fichier en écriture");
+        }
+        ecrire(sortie);
+        sortie.close();
+        if (!sortie) {
+            throw std::runtime_error("Erreur d'écriture dans " + temporaire.string());
+        }
+        if (options.synchroniser) {
+            forcerSurDisque(temporaire);
+        }
+        tournerSauvegardes(fichier, options);
+        std::filesystem::rename(temporaire, fichier);
+        if (options.synchroniser) {
+            const auto dossier = fichier.parent_path();
+            forcerSurDisque(dossier.empty() ? std::filesystem::path(".") : dossier);
+        }
+    } catch (...) {
+        std::error_code erreur;
+        std::filesystem::remove(temporaire, erreur);
+        throw;
+    }
+}
+
+inline void sauvegarderCSV(const std::filesystem::path& fichier,
+                           const std::vector<Etudiant>& etudiants,
+                           const OptionsSauvegarde& options = {}) {
+    ecrireAtomique(fichier, options, [&etudiants](std::ostream& sortie) {
+        for (const auto& etudiant : etudiants) {
+            ecrireEtudiant(sortie, etudiant.nom, etudiant.prenom, etudiant.moyenne);
+        }
+    });
+}
+
+// Une ligne du fichier vue sans copie : nom et prénom pointent dans le
+// tampon du lecteur et ne sont valables que jusqu'à la ligne suivante.
+struct EtudiantVue {
+    std::string_view nom;
+    std::string_view prenom;
+    double moyenne;
+};
+
+// Lecture en flux d'un CSV nom,prenom,moyenne : le fichier passe par un
+// tampon de taille fixe, rechargé au fur et à mesure. La mémoire utilisée
+// ne dépend pas de la taille du fichier ; une ligne plus longue que le
+// tampon est signalée et ignorée. Utilisable dans une boucle for :
+//     for (const EtudiantVue& e : LecteurEtudiants(fichier)) { ... }
+class LecteurEtudiants {
+public:
+    class iterateur {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = EtudiantVue;
+        using difference_type = std::ptrdiff_t;
+
+        iterateur() = default;
+        explicit iterateur(LecteurEtudiants* lecteur) : lecteur_(lecteur) {
+            ++*this;
+        }
+        const EtudiantVue& operator*() const {
+            return lecteur_->courant_;
+        }
+        iterateur& operator++() {
+            if (!lecteur_->suivant()) {
+                lecteur_ = nullptr;
+            }
+            return *this;
+        }
+        void operator++(int) {
+            ++*this;
+        }
+        bool operator==(std::default_sentinel_t) const {
+            return lecteur_ == nullptr;
+        }
+
+    private:
+        LecteurEtudiants* lecteur_ = nullptr;
+    };
+
+    explicit LecteurEtudiants(const std::filesystem::path& fichier,
+                              std::size_t tailleTampon = 64 * 1024)
+        : entree_(fichier, std::ios::binary), tampon_(tailleTampon) {
+        if (!entree_) {
+            throw std::runtime_error("Fichier introuvable : " + fichier.string());
+        }
+    }
+
+    // Un seul parcours : le fichier est lu au fil de l'itération.
+    iterateur begin() {
+        return iterateur(this);
+    }
+    std::default_sentinel_t end() const {
+        return std::default_sentinel;
+    }
+
+    int lignesLues() const {
+        return numeroLigne_;
+    }
+    int lignesIgnorees() const {
+        return ignorees_;
+    }
+
+private:
+    // Ligne suivante du tampon (sans le '\n'), rechargé si besoin ; faux à
+    // la fin du fichier.
+    bool ligneSuivante(std::string_view& ligne) {
+        while (true) {
+            const auto disponible = std::string_view(tampon_.data() + debut_, fin_ - debut_);
+            const auto finLigne = disponible.find('\n');
+            if (finLigne != std::string_view::npos) {
+                ligne = disponible.substr(0, finLigne);
+                debut_ += finLigne + 1;
+                return true;
+            }
+            if (finFichier_) {
+                if (disponible.empty()) {
+                    return false;
+                }
+                ligne = disponible;    // dernière ligne, sans '\n'
+                debut_ = fin_;
+                return true;
+            }
+            if (debut_ == 0 && fin_ == tampon_.size()) {
+                // Ligne plus longue que le tampon : on la saute jusqu'au '\n'.
+                ++numeroLigne_;
+                ++ignorees_;
+                std::cerr << "Ligne " << numeroLigne_ << " trop longue, ignorée.\n";
+                entree_.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                debut_ = fin_ = 0;
+                finFichier_ = !entree_;
+                continue;
+            }
+            recharger();
+        }
+    }
+
+    // Garde la ligne entamée au début du tampon et complète avec le fichier.
+    void recharger() {
+        std::copy(tampon_.begin() + static_cast<std::ptrdiff_t>(debut_),
+                  tampon_.begin() + static_cast<std::ptrdiff_t>(fin_), tampon_.begin());
+        fin_ -= debut_;
+        debut_ = 0;
+        entree_.read(tampon_.data() + fin_, static_cast<std::streamsize>(tampon_.size() - fin_));
+        fin_ += static_cast<std::size_t>(entree_.gcount());
+        finFichier_ = !entree_;
+    }
+
+    // Prochain étudiant valide ; les lignes vides sont sautées, les lignes
+    // invalides signalées avec leur numéro.
+    bool suivant() {
+        std::string_view ligne;
+        while (ligneSuivante(ligne)) {
+            ++numeroLigne_;
+            if (ligne.empty()) {
+                continue;
+            }
+            const auto virgule1 = ligne.find(',');
+            const auto virgule2 =
+                virgule1 == std::string_view::npos ? virgule1 : ligne.find(',', virgule1 + 1);
+            if (virgule2 == std::string_view::npos) {
+                ++ignorees_;
+                std::cerr << "Ligne " << numeroLigne_ << " mal formée, ignorée.\n";
+                continue;
+            }
+            const auto moyenne = moyenneDepuisTexte(ligne.substr(virgule2 + 1));
+            if (!moyenne) {
+                ++ignorees_;
+                std::cerr << "Moyenne invalide à la ligne " << numeroLigne_ << ", ignorée.\n";
+                continue;
+            }
+            courant_.moyenne = *moyenne;
+            courant_.nom = ligne.substr(0, virgule1);
+            courant_.prenom = ligne.substr(virgule1 + 1, virgule2 - virgule1 - 1);
+            return true;
+        }
+        return false;
+    }
+
+    std::ifstream entree_;
+    std::vector<char> tampon_;
+    std::size_t debut_ = 0;    // début de la partie non lue du tampon
+    std::size_t fin_ = 0;      // fin des octets valides du tampon
+    bool finFichier_ = false;
+    int numeroLigne_ = 0;
+    int ignorees_ = 0;
+    EtudiantVue courant_{};
+};
+
+// Pour les petits fichiers : tous les étudiants en mémoire.
+inline std::vector<Etudiant> chargerCSV(const std::filesystem::path& fichier) {
+    std::vector<Etudiant> etudiants;
+    for (const EtudiantVue& e : LecteurEtudiants(fichier)) {
+        etudiants.push_back({std::string(e.nom), std::string(e.prenom), e.moyenne});
+    }
+    return etudiants;
+}
+
+// --- Tri externe par moyenne décroissante ---
+// Pour un fichier plus gros que la mémoire : on le lit par paquets
+// (« runs ») qui tiennent dans le budget, chaque paquet est trié puis écrit
+// dans un fichier temporaire, et les fichiers triés sont fusionnés
+// (fusion à k voies : un tas des têtes de fichier). À moyenne égale,
+// l'ordre du fichier d'origine est conservé.
+
+struct OptionsTriExterne {
+    std::size_t budgetOctets = 64 * 1024 * 1024;    // mémoire pour les étudiants lus
+    unsigned nbThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::filesystem::path dossierTemporaire = std::filesystem::temp_directory_path();
+};
+
+// Textes d'un étudiant alloués hors de la structure (approximation : les
+// textes courts tiennent dans la std::string elle-même).
+inline std::size_t tailleTextes(const Etudiant& etudiant) {
+    return etudiant.nom.size() + etudiant.prenom.size();
+}
+
+// Fusionne des fichiers déjà triés dans `sortie`. Chaque fichier a son
+// tampon de lecture ; l'indice du fichier départage les moyennes égales.
+inline void fusionnerFichiers(const std::vector<std::filesystem::path>& fichiers,
+                              std::ostream& sortie, std::size_t tailleTampon) {
+    std::vector<std::unique_ptr<LecteurEtudiants>> lecteurs;
+    std::vector<LecteurEtudiants::iterateur> tetes;
+    for (const auto& fichier : fichiers) {
+        lecteurs.push_back(std::make_unique<LecteurEtudiants>(fichier, tailleTampon));
+        tetes.push_back(lecteurs.back()->begin());
+    }
+    auto apres = [&tetes](std::size_t a, std::size_t b) {
+        const double ma = (*tetes[a]).moyenne;
+        const double mb = (*tetes[b]).moyenne;
+        return ma != mb ? ma < mb : a > b;
+    };
+    std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(apres)> tas(apres);
+    for (std::size_t i = 0; i < tetes.size(); ++i) {
+        if (tetes[i] != std::default_sentinel) {
+            tas.push(i);
+        }
+    }
+
+    while (!tas.empty()) {
+        const std::size_t i = tas.top();
+        tas.pop();
+        const EtudiantVue& e = *tetes[i];
+        ecrireEtudiant(sortie, e.nom, e.prenom, e.moyenne);
+        if (++tetes[i] != std::default_sentinel) {
+            tas.push(i);
+        }
+    }
+}
+
+// Trie `entree` dans `sortie` sans dépasser (à peu près) le budget mémoire.
+// Pendant que le fil principal lit le paquet suivant, jusqu'à nbThreads
+// paquets sont triés et écrits en parallèle : le budget est partagé entre
+// tous les paquets en mémoire. Renvoie le nombre d'étudiants triés.
+inline std::size_t trierCSVExterne(const std::filesystem::path& entree,
+                                   const std::filesystem::path& sortie,
+                                   const OptionsTriExterne& options = {}) {
+    constexpr std::size_t maxFusion = 64;    // fichiers fusionnés d'un coup
+    const std::size_t budgetPaquet = options.budgetOctets / (options.nbThreads + 1);
+
+    // Dossier de travail propre à cet appel, supprimé même en cas d'erreur.
+    struct DossierTemporaire {
+        std::filesystem::path chemin;
+        ~DossierTemporaire() {
+            std::error_code erreur;
+            std::filesystem::remove_all(chemin, erreur);
+        }
+    } dossier{options.dossierTemporaire / ("tri_etudiants_" + std::to_string(std::random_device{}()))};
+    std::filesystem::create_directories(dossier.chemin);
+
+    // Les fichiers de travail n'ont pas besoin de survivre à une coupure.
+    OptionsSauvegarde temporaire;
+    temporaire.synchroniser = false;
+    std::vector<std::filesystem::path> paquets;
+    std::deque<std::future<void>> enCours;
+    auto ecrirePaquet = [&](std::vector<Etudiant> paquet) {
+        const auto fichier = dossier.chemin / ("paquet_" + std::to_string(paquets.size()) + ".csv");
+        paquets.push_back(fichier);
+        if (enCours.size() >= options.nbThreads) {
+            enCours.front().get();
+            enCours.pop_front();
+        }
+        auto trier = [fichier, &temporaire, paquet = std::move(paquet)]() mutable {
+            std::stable_sort(paquet.begin(), paquet.end(),
+                             [](const auto& a, const auto& b) { return a.moyenne > b.moyenne; });
+            sauvegarderCSV(fichier, paquet, temporaire);
+        };
+        enCours.push_back(std::async(std::launch::async, std::move(trier)));
+    };
+
+    std::size_t total = 0;
+    std::vector<Etudiant> paquet;
+    std::size_t textes = 0;
+    for (const EtudiantVue& e : LecteurEtudiants(entree)) {
+        paquet.push_back({std::string(e.nom), std::string(e.prenom), e.moyenne});
+        textes += tailleTextes(paquet.back());
+        ++total;
+        if (paquet.size() * sizeof(Etudiant) + textes >= budgetPaquet) {
+            // Le paquet suivant aura sans doute la même taille : réservé
+            // d'avance, il évite les doublements de capacité.
+            const std::size_t nombre = paquet.size();
+            ecrirePaquet(std::move(paquet));
+            paquet = {};
+            paquet.reserve(nombre);
+            textes = 0;
+        }
+    }
+    if (!paquet.empty() || paquets.empty()) {
+        ecrirePaquet(std::move(paquet));
+    }
+    for (auto& travail : enCours) {
+        travail.get();
+    }
+
+    // Fusions intermédiaires si les paquets sont trop nombreux pour un seul
+    // passage ; chaque tampon de lecture prend sa part du budget.
+    const auto tailleTampon = [&options](std::size_t nbFichiers) {
+        return std::clamp<std::size_t>(options.budgetOctets / (nbFichiers + 1), 4096, 1 << 20);
+    };
+    for (std::size_t passe = 0; paquets.size() > maxFusion; ++passe) {
+        std::vector<std::filesystem::path> fusionnes;
+        for (std::size_t debut = 0; debut < paquets.size(); debut += maxFusion) {
+            const auto fin = std::min(paquets.size(), debut + maxFusion);
+            const std::vector<std::filesystem::path> groupe(
+                paquets.begin() + static_cast<std::ptrdiff_t>(debut),
+                paquets.begin() + static_cast<std::ptrdiff_t>(fin));
+            const auto nom = "fusion_" + std::to_string(passe) + "_" + std::to_string(debut) + ".csv";
+            fusionnes.push_back(dossier.chemin / nom);
+            ecrireAtomique(fusionnes.back(), temporaire, [&](std::ostream& flux) {
+                fusionnerFichiers(groupe, flux, tailleTampon(groupe.size()));
+            });
+            for (const auto& fichier : groupe) {
+                std::filesystem::remove(fichier);
+            }
+        }
+        paquets = std::move(fusionnes);
+    }
+    ecrireAtomique(sortie, OptionsSauvegarde{}, [&](std::ostream& flux) {
+        fusionnerFichiers(paquets, flux, tailleTampon(paquets.size()));
+    });
+    return total;
+}
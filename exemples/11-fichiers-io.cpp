@@ -1,17 +1,15 @@
 #include <algorithm>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
-#include <sstream>
 #include <string>
+#include <system_error>
 #include <vector>
 
-struct Etudiant {
-    std::string nom;
-    std::string prenom;
-    double moyenne;
-};
+// Etudiant, sauvegarderCSV, chargerCSV, LecteurEtudiants, trierCSVExterne...
+#include "11-etudiants-csv.hpp"
 
 void afficherEtudiants(const std::vector<Etudiant>& etudiants, const std::string& titre) {
     std::cout << "\n=== " << titre << " ===\n";
@@ -23,55 +21,6 @@ void afficherEtudiants(const std::vector<Etudiant>& etudiants, const std::string
     }
 }
 
-void sauvegarderCSV(const std::filesystem::path& fichier, const std::vector<Etudiant>& etudiants) {
-    std::ofstream sortie(fichier);
-    if (!sortie) {
-        throw std::runtime_error("Impossible d'ouvrir le fichier en écriture");
-    }
-
-    for (const auto& etudiant : etudiants) {
-        sortie << etudiant.nom << ',' << etudiant.prenom << ',' << etudiant.moyenne << '\n';
-    }
-}
-
-std::vector<Etudiant> chargerCSV(const std::filesystem::path& fichier) {
-    std::vector<Etudiant> etudiants;
-    std::ifstream entree(fichier);
-    if (!entree) {
-        throw std::runtime_error("Fichier introuvable : " + fichier.string());
-    }
-
-    std::string ligne;
-    int numeroLigne = 0;
-    while (std::getline(entree, ligne)) {
-        ++numeroLigne;
-        if (ligne.empty()) {
-            continue;
-        }
-
-        std::stringstream buffer(ligne);
-        std::string nom;
-        std::string prenom;
-        std::string moyenneStr;
-
-        if (!std::getline(buffer, nom, ',') ||
-            !std::getline(buffer, prenom, ',') ||
-            !std::getline(buffer, moyenneStr)) {
-            std::cerr << "Ligne " << numeroLigne << " mal formée, ignorée.\n";
-            continue;
-        }
-
-        try {
-            double moyenne = std::stod(moyenneStr);
-            etudiants.push_back({nom, prenom, moyenne});
-        } catch (const std::exception&) {
-            std::cerr << "Moyenne invalide à la ligne " << numeroLigne << ", ignorée.\n";
-        }
-    }
-
-    return etudiants;
-}
-
 int main() {
     const std::filesystem::path fichier = "etudiants.csv";
     const std::filesystem::path dossierBackup = "backup";
@@ -83,8 +32,12 @@ int main() {
         {"Petit", "Noah", 9.4}
     };
 
+    // Sauvegarde atomique : les 3 versions précédentes restent dans backup/.
+    OptionsSauvegarde sauvegarde;
+    sauvegarde.generations = 3;
+    sauvegarde.dossierBackup = dossierBackup;
     try {
-        sauvegarderCSV(fichier, etudiants);
+        sauvegarderCSV(fichier, etudiants, sauvegarde);
         std::cout << "Fichier CSV sauvegardé : " << fichier << "\n";
     } catch (const std::exception& e) {
         std::cerr << "Erreur de sauvegarde: " << e.what() << "\n";
@@ -97,10 +50,23 @@ int main() {
         std::cout << "Taille du fichier: " << taille << " octets\n";
     }
 
-    // Créer un dossier de backup si nécessaire
-    if (!std::filesystem::exists(dossierBackup)) {
-        std::filesystem::create_directory(dossierBackup);
-        std::cout << "Dossier de backup créé: " << dossierBackup << "\n";
+    // Une deuxième sauvegarde : la version précédente passe dans backup/
+    // par un lien dur, sans copie.
+    etudiants.push_back({"Leroy", "Jade", 15.1});
+    try {
+        sauvegarderCSV(fichier, etudiants, sauvegarde);
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur de sauvegarde: " << e.what() << "\n";
+        return 1;
+    }
+    std::vector<std::filesystem::path> versions;
+    for (const auto& entree : std::filesystem::directory_iterator(dossierBackup)) {
+        versions.push_back(entree.path());
+    }
+    std::sort(versions.begin(), versions.end());
+    for (const auto& version : versions) {
+        std::cout << "Version précédente : " << version.string() << " ("
+                  << std::filesystem::file_size(version) << " octets)\n";
     }
 
     std::vector<Etudiant> charges;
@@ -115,20 +81,78 @@ int main() {
               [](const auto& a, const auto& b) { return a.moyenne > b.moyenne; });
     afficherEtudiants(charges, "Étudiants triés par moyenne décroissante");
 
+    // Le même tri pour un fichier trop gros pour la mémoire : ici un budget
+    // minuscule force un paquet par étudiant.
+    const std::filesystem::path fichierTrie = "etudiants_tries.csv";
+    try {
+        OptionsTriExterne options;
+        options.budgetOctets = 1;
+        trierCSVExterne(fichier, fichierTrie, options);
+        afficherEtudiants(chargerCSV(fichierTrie), "Tri externe (un paquet par étudiant)");
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur de tri: " << e.what() << "\n";
+        return 1;
+    }
+
+    // Un export trop gros pour la mémoire se parcourt en flux : filtre et
+    // agrégat en mémoire constante. Deux lignes invalides montrent les
+    // erreurs signalées avec leur numéro de ligne.
+    {
+        std::ofstream ajout(fichier, std::ios::app);
+        ajout << "Bernard;Léa;12.0\n" << "Moreau,Hugo,abc\n" << "Roux,Inès,10.5\n";
+    }
+    try {
+        LecteurEtudiants lecteur(fichier);
+        int admis = 0;
+        double somme = 0;
+        for (const EtudiantVue& e : lecteur) {
+            if (e.moyenne >= 10) {
+                ++admis;
+                somme += e.moyenne;
+            }
+        }
+        std::cout << "\n" << admis << " étudiant(s) avec au moins 10, moyenne "
+                  << (admis > 0 ? somme / admis : 0.0) << " (" << lecteur.lignesLues()
+                  << " lignes lues, " << lecteur.lignesIgnorees() << " ignorée(s))\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur de lecture: " << e.what() << "\n";
+        return 1;
+    }
+
+    // etudiants.csv reste à consulter ; le fichier trié et les versions de
+    // backup/ ne servaient qu'à la démonstration. Le dossier n'est retiré
+    // que s'il ne contient rien d'autre.
+    std::error_code erreur;
+    std::filesystem::remove(fichierTrie, erreur);
+    for (int numero = 1; numero <= sauvegarde.generations; ++numero) {
+        const auto version = fichier.filename().string() + "." + std::to_string(numero);
+        std::filesystem::remove(dossierBackup / version, erreur);
+    }
+    std::filesystem::remove(dossierBackup, erreur);
     return 0;
 }
 
 /*
  * Ce programme démontre :
  * - std::ofstream et std::ifstream avec RAII
- * - Parsing CSV avec std::getline et std::stringstream
+ * - Lecture en flux par un tampon de taille fixe (mémoire constante),
+ *   parcourue avec un range-for (itérateur + std::default_sentinel)
+ * - std::string_view pour découper une ligne sans copie
+ * - std::to_chars / std::from_chars : conversion des moyennes sans locale,
+ *   avec aller-retour exact
+ * - Tri externe : paquets triés en parallèle (std::async), fichiers
+ *   temporaires, fusion à k voies avec std::priority_queue
  * - Gestion d'erreurs sur les fichiers
- * - std::filesystem (exists, file_size, create_directory)
+ * - std::filesystem (exists, file_size, directory_iterator, rename,
+ *   create_hard_link)
+ * - Sauvegarde atomique : fichier temporaire, fsync, rename, anciennes
+ *   versions gardées par liens durs
  * - Tri des données avec std::sort
  */
 
 /*
  * Compilation et exécution :
  * g++ -std=c++20 -Wall -Wextra -O2 11-fichiers-io.cpp -o fichiers_io
+ *   (11-etudiants-csv.hpp doit se trouver dans le même dossier)
  * ./fichiers_io
  */
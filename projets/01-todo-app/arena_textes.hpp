@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Tas de textes en blocs (arène monotone) : un texte ajouté n'est jamais
+// déplacé ni libéré individuellement. Contrairement à une seule
+// std::string qui double en recopiant tout son contenu, l'arène ne fait
+// qu'ajouter un bloc quand le précédent est plein.
+// Un texte est désigné par une poignée : numéro de bloc sur les 24 bits de
+// poids fort, position dans le bloc sur les 40 bits de poids faible.
+class ArenaTextes {
+public:
+    using Poignee = std::uint64_t;
+    static constexpr std::size_t tailleBloc = 1 << 20;
+    static constexpr unsigned bitsPosition = 40;
+    static constexpr Poignee masquePosition = (Poignee{1} << bitsPosition) - 1;
+
+    std::string_view texte(Poignee poignee, std::uint32_t longueur) const {
+        return {blocs_[poignee >> bitsPosition].data() + (poignee & masquePosition), longueur};
+    }
+
+    // Garantit `octets` de place libre dans le bloc courant ; un nouveau
+    // bloc fait au moins `tailleMin` octets.
+    void reserver(std::size_t octets, std::size_t tailleMin = tailleBloc) {
+        if (blocs_.empty() || blocs_.back().capacity() - blocs_.back().size() < octets) {
+            blocs_.emplace_back().reserve(std::max(octets, tailleMin));
+        }
+    }
+
+    // `ecrire(bloc)` ajoute au plus `tailleMax` octets à la fin du bloc :
+    // la place étant réservée, le bloc ne se réalloue pas.
+    template <typename Ecrivain>
+    Poignee ecrire(std::size_t tailleMax, Ecrivain&& ecrire, std::uint32_t& longueur) {
+        reserver(tailleMax);
+        std::string& bloc = blocs_.back();
+        const std::size_t debut = bloc.size();
+        ecrire(bloc);
+        longueur = static_cast<std::uint32_t>(bloc.size() - debut);
+        return Poignee{blocs_.size() - 1} << bitsPosition | debut;
+    }
+    Poignee ajouter(std::string_view texte) {
+        std::uint32_t longueur = 0;
+        return ecrire(texte.size(), [texte](std::string& bloc) { bloc.append(texte); }, longueur);
+    }
+    // Retire le dernier texte écrit, désigné par `poignee`.
+    void annulerDernier(Poignee poignee) {
+        blocs_.back().resize(poignee & masquePosition);
+    }
+
+    // Bloc de `taille` octets à remplir directement ; sa poignée de début
+    // est renvoyée dans `debut`.
+    char* nouveauBloc(std::size_t taille, Poignee& debut) {
+        debut = Poignee{blocs_.size()} << bitsPosition;
+        return blocs_.emplace_back(taille, '\0').data();
+    }
+
+    // Reprend les blocs de `autre` sans recopier les textes ; renvoie ce
+    // qu'il faut ajouter à ses poignées.
+    Poignee adopter(ArenaTextes&& autre) {
+        const Poignee decalage = Poignee{blocs_.size()} << bitsPosition;
+        blocs_.insert(blocs_.end(), std::make_move_iterator(autre.blocs_.begin()),
+                      std::make_move_iterator(autre.blocs_.end()));
+        autre.blocs_.clear();
+        return decalage;
+    }
+
+    std::size_t nbBlocs() const {
+        return blocs_.size();
+    }
+    std::size_t octetsUtilises() const {
+        std::size_t total = 0;
+        for (const auto& bloc : blocs_) {
+            total += bloc.size();
+        }
+        return total;
+    }
+    void vider() {
+        blocs_.clear();
+    }
+
+private:
+    std::vector<std::string> blocs_;
+};
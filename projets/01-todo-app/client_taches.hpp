@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Client du serveur de serveur_taches.hpp : Linux seulement, comme lui.
+#if !defined(__linux__)
+#error "client_taches.hpp n'est disponible que sous Linux"
+#endif
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "serveur_taches.hpp"
+
+// Une tâche reçue du serveur : une copie, qui ne dépend d'aucune table.
+struct TacheRecue {
+    int id;
+    std::string description;
+    Statut statut;
+    Priorite priorite;
+    DateCompacte dateEcheance;
+
+    bool operator==(const TacheRecue&) const = default;
+};
+
+struct ReponseTaches {
+    bool ok = false;
+    int id = 0;                        // ajout
+    std::vector<TacheRecue> taches;    // recherche, filtre, liste
+};
+
+// Client de ServeurTaches, bloquant. Les méthodes demander* ne font que
+// préparer une requête ; envoyer() les expédie toutes d'un coup, et
+// recevoir() lit les réponses une à une, dans le même ordre (pipelining).
+// Les autres méthodes font les trois étapes pour une seule requête.
+class ClientTaches {
+public:
+    ClientTaches() = default;
+    ClientTaches(const ClientTaches&) = delete;
+    ClientTaches& operator=(const ClientTaches&) = delete;
+    ~ClientTaches() {
+        if (socket_ >= 0) {
+            ::close(socket_);
+        }
+    }
+
+    bool connecter(const std::filesystem::path& chemin) {
+        sockaddr_un adresse{};
+        adresse.sun_family = AF_UNIX;
+        const std::string texte = chemin.string();
+        if (texte.size() >= sizeof(adresse.sun_path)) {
+            return false;
+        }
+        std::memcpy(adresse.sun_path, texte.c_str(), texte.size() + 1);
+        socket_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        return socket_ >= 0 &&
+               ::connect(socket_, reinterpret_cast<const sockaddr*>(&adresse), sizeof(adresse)) == 0;
+    }
+
+    void demanderAjout(std::string_view description, Priorite priorite, std::string_view date) {
+        const auto trame = commencer(protocole::Requete::Ajout);
+        protocole::ajouter(sortie_, static_cast<std::uint8_t>(priorite));
+        // Une date de plus de 255 caractères est de toute façon invalide.
+        date = date.substr(0, 255);
+        protocole::ajouter(sortie_, static_cast<std::uint8_t>(date.size()));
+        sortie_ += date;
+        sortie_ += description;
+        terminer(trame);
+    }
+    void demanderStatut(int id, Statut statut) {
+        const auto trame = commencer(protocole::Requete::Statut);
+        protocole::ajouter<std::int32_t>(sortie_, id);
+        protocole::ajouter(sortie_, static_cast<std::uint8_t>(statut));
+        terminer(trame);
+    }
+    void demanderSuppression(int id) {
+        const auto trame = commencer(protocole::Requete::Suppression);
+        protocole::ajouter<std::int32_t>(sortie_, id);
+        terminer(trame);
+    }
+    void demanderRecherche(std::string_view motCle) {
+        const auto trame = commencer(protocole::Requete::Recherche);
+        sortie_ += motCle;
+        terminer(trame);
+    }
+    void demanderFiltre(Statut statut) {
+        const auto trame = commencer(protocole::Requete::Filtre);
+        protocole::ajouter(sortie_, static_cast<std::uint8_t>(statut));
+        terminer(trame);
+    }
+    void demanderListe(Ordre ordre, std::uint32_t limite = protocole::toutes) {
+        const auto trame = commencer(protocole::Requete::Liste);
+        protocole::ajouter(sortie_, static_cast<std::uint8_t>(ordre));
+        protocole::ajouter(sortie_, limite);
+        terminer(trame);
+    }
+    void demanderSauvegarde() {
+        terminer(commencer(protocole::Requete::Sauvegarde));
+    }
+
+    // Envoie toutes les requêtes préparées.
+    bool envoyer() {
+        std::size_t envoyes = 0;
+        while (envoyes < sortie_.size()) {
+            const auto n = ::send(socket_, sortie_.data() + envoyes, sortie_.size() - envoyes,
+                                  MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return false;
+            }
+            envoyes += static_cast<std::size_t>(n);
+        }
+        sortie_.clear();
+        return true;
+    }
+    // Réponse à la plus ancienne requête envoyée, pages réunies ; rien si
+    // la connexion est perdue ou si une trame dépasse tailleMaxTrame.
+    std::optional<ReponseTaches> recevoir() {
+        if (attendues_.empty()) {
+            return std::nullopt;
+        }
+        ReponseTaches reponse;
+        while (true) {
+            const std::string_view restant = std::string_view(entree_).substr(lus_);
+            const auto longueur = protocole::longueurTrame(restant);
+            if (longueur && *longueur > protocole::tailleMaxTrame) {
+                return std::nullopt;
+            }
+            if (longueur && restant.size() >= protocole::tailleEnTete + *longueur) {
+                const auto trame = restant.substr(protocole::tailleEnTete, *longueur);
+                const bool suite =
+                    !trame.empty() && trame[0] == static_cast<char>(protocole::Code::Suite);
+                decoder(trame, reponse);
+                lus_ += protocole::tailleEnTete + *longueur;
+                if (lus_ == entree_.size()) {
+                    entree_.clear();
+                    lus_ = 0;
+                }
+                if (suite) {
+                    continue;
+                }
+                attendues_.pop_front();
+                return reponse;
+            }
+            entree_.erase(0, lus_);
+            lus_ = 0;
+            constexpr std::size_t tailleLecture = 64 * 1024;
+            const std::size_t avant = entree_.size();
+            entree_.resize(avant + tailleLecture);
+            const auto n = ::recv(socket_, entree_.data() + avant, tailleLecture, 0);
+            entree_.resize(avant + static_cast<std::size_t>(n > 0 ? n : 0));
+            if (n == 0 || (n < 0 && errno != EINTR)) {
+                return std::nullopt;
+            }
+        }
+    }
+
+    std::optional<int> ajouterTache(std::string_view description, Priorite priorite,
+                                    std::string_view date) {
+        demanderAjout(description, priorite, date);
+        const auto reponse = echanger();
+        return reponse && reponse->ok ? std::optional<int>(reponse->id) : std::nullopt;
+    }
+    bool changerStatut(int id, Statut statut) {
+        demanderStatut(id, statut);
+        const auto reponse = echanger();
+        return reponse && reponse->ok;
+    }
+    bool supprimerTache(int id) {
+        demanderSuppression(id);
+        const auto reponse = echanger();
+        return reponse && reponse->ok;
+    }
+    std::optional<std::vector<TacheRecue>> rechercherMotCle(std::string_view motCle) {
+        demanderRecherche(motCle);
+        return taches(echanger());
+    }
+    std::optional<std::vector<TacheRecue>> filtrerParStatut(Statut statut) {
+        demanderFiltre(statut);
+        return taches(echanger());
+    }
+    std::optional<std::vector<TacheRecue>> lister(Ordre ordre,
+                                                  std::uint32_t limite = protocole::toutes) {
+        demanderListe(ordre, limite);
+        return taches(echanger());
+    }
+    bool sauvegarder() {
+        demanderSauvegarde();
+        const auto reponse = echanger();
+        return reponse && reponse->ok;
+    }
+
+private:
+    std::size_t commencer(protocole::Requete requete) {
+        const auto trame = protocole::ouvrirTrame(sortie_);
+        protocole::ajouter(sortie_, static_cast<std::uint8_t>(requete));
+        attendues_.push_back(requete);
+        return trame;
+    }
+
+    // Une requête trop longue pour une trame (description ou mot-clé
+    // démesuré) est remplacée par une trame d'un octet nul, que le serveur
+    // refuse : la réponse reste à sa place dans l'ordre des réponses.
+    void terminer(std::size_t trame) {
+        if (!protocole::fermerTrame(sortie_, trame)) {
+            const auto remplacante = protocole::ouvrirTrame(sortie_);
+            sortie_ += '\0';
+            protocole::fermerTrame(sortie_, remplacante);
+        }
+    }
+
+    std::optional<ReponseTaches> echanger() {
+        if (!envoyer()) {
+            return std::nullopt;
+        }
+        return recevoir();
+    }
+    static std::optional<std::vector<TacheRecue>> taches(std::optional<ReponseTaches> reponse) {
+        if (!reponse || !reponse->ok) {
+            return std::nullopt;
+        }
+        return std::move(reponse->taches);
+    }
+
+    // Le contenu d'une réponse dépend de la requête : d'où la file des
+    // requêtes en attente. Les tâches d'une page s'ajoutent à celles des
+    // pages précédentes.
+    void decoder(std::string_view trame, ReponseTaches& reponse) const {
+        using protocole::Code;
+        using protocole::Requete;
+        reponse.ok = !trame.empty() && (trame[0] == static_cast<char>(Code::Ok) ||
+                                        trame[0] == static_cast<char>(Code::Suite));
+        if (!reponse.ok) {
+            reponse.taches.clear();
+            return;
+        }
+        const Requete requete = attendues_.front();
+        if (requete == Requete::Ajout && trame.size() >= 5) {
+            reponse.id = instantane::lire<std::int32_t>(trame.data() + 1);
+        } else if ((requete == Requete::Recherche || requete == Requete::Filtre ||
+                    requete == Requete::Liste) &&
+                   trame.size() >= 5) {
+            const auto nombre = instantane::lire<std::uint32_t>(trame.data() + 1);
+            reponse.taches.reserve(nombre);
+            std::size_t position = 5;
+            for (std::uint32_t i = 0; i < nombre && position + 14 <= trame.size(); ++i) {
+                const char* octets = trame.data() + position;
+                const auto longueur = instantane::lire<std::uint32_t>(octets + 10);
+                reponse.taches.push_back({instantane::lire<std::int32_t>(octets),
+                                          std::string(trame.substr(position + 14, longueur)),
+                                          static_cast<Statut>(octets[4]),
+                                          static_cast<Priorite>(octets[5]),
+                                          instantane::lire<std::uint32_t>(octets + 6)});
+                position += 14 + longueur;
+            }
+        }
+    }
+
+    int socket_ = -1;
+    std::string sortie_;
+    std::string entree_;
+    std::size_t lus_ = 0;    // octets de `entree_` déjà décodés
+    std::deque<protocole::Requete> attendues_;
+};
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "taches.hpp"
+
+// Mode commandes de la todo app : une commande par ligne, champs séparés
+// par des tabulations (la description, en dernier, peut contenir des
+// espaces). Lignes vides et commentaires (#) ignorés.
+//
+//   ajouter     PRIORITE  date (vide : sans échéance)  description
+//   supprimer   id
+//   statut      id  STATUT
+//   rechercher  mot-clé
+//   filtrer     STATUT
+//   sauvegarder
+//
+// Une ligne de réponse par commande, elle aussi en TSV :
+//   ok              (ok  id  pour un ajout)
+//   ok  n           suivie de n lignes  id  STATUT  PRIORITE  date  description
+//   erreur  numéro de ligne  raison
+//
+// Les modifications qui se suivent sont regroupées dans un LotTaches,
+// appliqué d'un bloc (une seule entrée de journal) dès qu'il atteint
+// tailleLot ou qu'une lecture ou une sauvegarde arrive. Si le lot est
+// refusé, ses commandes sont rejouées une par une pour savoir lesquelles
+// échouent. Les réponses sortent par blocs, sans flush par commande.
+class InterpreteurCommandes {
+public:
+    static constexpr std::size_t tailleLot = 1 << 16;
+
+    struct Bilan {
+        std::size_t commandes = 0;
+        std::size_t erreurs = 0;
+    };
+
+    InterpreteurCommandes(GestionnaireTaches& gestionnaire, std::ostream& sortie)
+        : gestionnaire_(gestionnaire), sortie_(sortie) {}
+    InterpreteurCommandes(const InterpreteurCommandes&) = delete;
+    InterpreteurCommandes& operator=(const InterpreteurCommandes&) = delete;
+    ~InterpreteurCommandes() {
+        terminer();
+    }
+
+    void executer(std::string_view ligne) {
+        ++numeroLigne_;
+        if (!ligne.empty() && ligne.back() == '\r') {
+            ligne.remove_suffix(1);
+        }
+        if (ligne.empty() || ligne.front() == '#') {
+            return;
+        }
+        ++bilan_.commandes;
+        const auto [commande, reste] = couper(ligne);
+
+        if (commande == "ajouter") {
+            const auto [textePriorite, apresPriorite] = couper(reste);
+            const auto [date, description] = couper(apresPriorite);
+            const auto priorite = prioriteDepuisTexte(textePriorite);
+            if (!priorite) {
+                erreur("priorité inconnue");
+                return;
+            }
+            if (!dateDepuisTexte(date)) {
+                erreur("date invalide");
+                return;
+            }
+            if (description.empty()) {
+                erreur("description vide");
+                return;
+            }
+            lot_.ajouter(description, *priorite, date);
+            attente_.push_back({numeroLigne_, Commande::Ajout, 0,
+                                static_cast<std::uint8_t>(*priorite),
+                                static_cast<std::uint32_t>(textes_.size()),
+                                static_cast<std::uint32_t>(date.size()),
+                                static_cast<std::uint32_t>(description.size())});
+            textes_ += date;
+            textes_ += description;
+        } else if (commande == "supprimer" || commande == "statut") {
+            const auto [texteId, texteStatut] = couper(reste);
+            const auto id = entier(texteId);
+            if (!id) {
+                erreur("id invalide");
+                return;
+            }
+            if (commande == "supprimer") {
+                lot_.supprimer(*id);
+                attente_.push_back({numeroLigne_, Commande::Suppression, *id, 0, 0, 0, 0});
+            } else {
+                const auto statut = statutDepuisTexte(texteStatut);
+                if (!statut) {
+                    erreur("statut inconnu");
+                    return;
+                }
+                lot_.changerStatut(*id, *statut);
+                attente_.push_back({numeroLigne_, Commande::Statut, *id,
+                                    static_cast<std::uint8_t>(*statut), 0, 0, 0});
+            }
+        } else if (commande == "rechercher") {
+            appliquerAttente();
+            ecrireTaches(gestionnaire_.rechercherMotCle(reste));
+        } else if (commande == "filtrer") {
+            const auto statut = statutDepuisTexte(reste);
+            if (!statut) {
+                erreur("statut inconnu");
+                return;
+            }
+            appliquerAttente();
+            ecrireTaches(gestionnaire_.filtrerParStatut(*statut));
+        } else if (commande == "sauvegarder") {
+            appliquerAttente();
+            if (!gestionnaire_.synchroniser()) {
+                erreur("sauvegarde impossible");
+                return;
+            }
+            sortie_.ajouter("ok\n");
+        } else {
+            erreur("commande inconnue");
+            return;
+        }
+        if (lot_.taille() >= tailleLot) {
+            appliquerAttente();
+        }
+    }
+
+    // Applique les modifications en attente et vide les réponses vers le
+    // flux.
+    void terminer() {
+        appliquerAttente();
+        sortie_.vider();
+    }
+
+    Bilan bilan() const {
+        return bilan_;
+    }
+
+private:
+    enum class Commande : std::uint8_t { Ajout, Statut, Suppression };
+    // De quoi répondre à une modification du lot, ou la rejouer seule.
+    struct EnAttente {
+        std::size_t numeroLigne;
+        Commande commande;
+        int id;
+        std::uint8_t valeur;    // priorité (ajout) ou statut
+        std::uint32_t debut;    // date puis description, dans textes_
+        std::uint32_t longueurDate;
+        std::uint32_t longueurDescription;
+    };
+
+    // Premier champ, et le reste de la ligne après la tabulation.
+    static std::array<std::string_view, 2> couper(std::string_view texte) {
+        const auto tab = texte.find('\t');
+        if (tab == std::string_view::npos) {
+            return {texte, {}};
+        }
+        return {texte.substr(0, tab), texte.substr(tab + 1)};
+    }
+    static std::optional<int> entier(std::string_view texte) {
+        int valeur = 0;
+        const auto [fin, code] = std::from_chars(texte.data(), texte.data() + texte.size(), valeur);
+        if (code != std::errc{} || fin != texte.data() + texte.size()) {
+            return std::nullopt;
+        }
+        return valeur;
+    }
+
+    void appliquerAttente() {
+        if (attente_.empty()) {
+            return;
+        }
+        if (const auto ids = gestionnaire_.appliquer(lot_)) {
+            std::size_t ajout = 0;
+            for (const auto& commande : attente_) {
+                if (commande.commande == Commande::Ajout) {
+                    ecrireOk((*ids)[ajout++]);
+                } else {
+                    sortie_.ajouter("ok\n");
+                }
+            }
+        } else {
+            for (const auto& commande : attente_) {
+                rejouer(commande);
+            }
+        }
+        lot_.vider();
+        attente_.clear();
+        textes_.clear();
+    }
+    void rejouer(const EnAttente& commande) {
+        if (commande.commande == Commande::Ajout) {
+            const auto texte = std::string_view(textes_).substr(commande.debut);
+            const auto date = texte.substr(0, commande.longueurDate);
+            const auto description = texte.substr(commande.longueurDate, commande.longueurDescription);
+            // Date déjà vérifiée : l'ajout seul ne peut pas échouer.
+            ecrireOk(*gestionnaire_.ajouterTache(description, static_cast<Priorite>(commande.valeur),
+                                                 date));
+            return;
+        }
+        const bool fait = commande.commande == Commande::Statut
+                              ? gestionnaire_.changerStatut(commande.id,
+                                                            static_cast<Statut>(commande.valeur))
+                              : gestionnaire_.supprimerTache(commande.id);
+        if (fait) {
+            sortie_.ajouter("ok\n");
+        } else {
+            ecrireErreur(commande.numeroLigne, "tâche introuvable");
+        }
+    }
+
+    void erreur(std::string_view raison) {
+        appliquerAttente();
+        ecrireErreur(numeroLigne_, raison);
+    }
+    void ecrireErreur(std::size_t numeroLigne, std::string_view raison) {
+        ++bilan_.erreurs;
+        sortie_.ajouter("erreur\t");
+        ecrireNombre(numeroLigne);
+        sortie_.ajouter("\t");
+        sortie_.ajouter(raison);
+        sortie_.ajouter("\n");
+    }
+    void ecrireOk(int id) {
+        sortie_.ajouter("ok\t");
+        ecrireNombre(id);
+        sortie_.ajouter("\n");
+    }
+    void ecrireTaches(const simd::Selection& lignes) {
+        sortie_.ajouter("ok\t");
+        ecrireNombre(lignes.size());
+        sortie_.ajouter("\n");
+        for (const auto ligne : lignes) {
+            const Tache tache = gestionnaire_.table().ligne(ligne);
+            ecrireNombre(tache.id);
+            sortie_.ajouter("\t");
+            sortie_.ajouter(versTexte(tache.statut));
+            sortie_.ajouter("\t");
+            sortie_.ajouter(versTexte(tache.priorite));
+            sortie_.ajouter("\t");
+            char date[10];
+            sortie_.ajouter(std::string_view(date, static_cast<std::size_t>(
+                                                       ecrireDate(date, tache.dateEcheance) - date)));
+            sortie_.ajouter("\t");
+            sortie_.ajouter(tache.description);
+            sortie_.ajouter("\n");
+        }
+    }
+    template <typename Entier>
+    void ecrireNombre(Entier valeur) {
+        char texte[24];
+        const auto fin = std::to_chars(texte, texte + sizeof(texte), valeur).ptr;
+        sortie_.ajouter(std::string_view(texte, static_cast<std::size_t>(fin - texte)));
+    }
+
+    GestionnaireTaches& gestionnaire_;
+    RenduTaches sortie_;
+    LotTaches lot_;
+    std::vector<EnAttente> attente_;
+    std::string textes_;
+    std::size_t numeroLigne_ = 0;
+    Bilan bilan_;
+};
+
+// Exécute toutes les commandes de `entree`.
+inline InterpreteurCommandes::Bilan executerCommandes(GestionnaireTaches& gestionnaire,
+                                                     std::istream& entree, std::ostream& sortie) {
+    InterpreteurCommandes interpreteur(gestionnaire, sortie);
+    std::string ligne;
+    while (std::getline(entree, ligne)) {
+        interpreteur.executer(ligne);
+    }
+    interpreteur.terminer();
+    return interpreteur.bilan();
+}
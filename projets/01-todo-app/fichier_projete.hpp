@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#include <string>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Projection en lecture seule d'un fichier en mémoire (RAII).
+// Le contenu est exposé comme un std::string_view : aucune copie, les pages
+// sont chargées par le système à la demande. Sous Windows, on se contente
+// de lire le fichier d'un bloc dans un tampon.
+class FichierProjete {
+public:
+    explicit FichierProjete(const std::filesystem::path& chemin) {
+#if defined(_WIN32)
+        std::ifstream entree(chemin, std::ios::binary);
+        if (!entree) {
+            return;
+        }
+        tampon_.assign(std::istreambuf_iterator<char>(entree), std::istreambuf_iterator<char>());
+        ouvert_ = true;
+#else
+        const int descripteur = ::open(chemin.c_str(), O_RDONLY);
+        if (descripteur < 0) {
+            return;
+        }
+        struct stat infos {};
+        if (::fstat(descripteur, &infos) == 0) {
+            taille_ = static_cast<std::size_t>(infos.st_size);
+            ouvert_ = true;
+            if (taille_ > 0) {
+                void* adresse = ::mmap(nullptr, taille_, PROT_READ, MAP_PRIVATE, descripteur, 0);
+                if (adresse == MAP_FAILED) {
+                    ouvert_ = false;
+                    taille_ = 0;
+                } else {
+                    donnees_ = static_cast<const char*>(adresse);
+                    ::madvise(adresse, taille_, MADV_SEQUENTIAL);
+                }
+            }
+        }
+        ::close(descripteur);
+#endif
+    }
+
+    ~FichierProjete() {
+#if !defined(_WIN32)
+        if (donnees_ != nullptr) {
+            ::munmap(const_cast<char*>(donnees_), taille_);
+        }
+#endif
+    }
+
+    FichierProjete(const FichierProjete&) = delete;
+    FichierProjete& operator=(const FichierProjete&) = delete;
+
+    bool ouvert() const {
+        return ouvert_;
+    }
+
+    std::string_view contenu() const {
+#if defined(_WIN32)
+        return tampon_;
+#else
+        return {donnees_ == nullptr ? "" : donnees_, taille_};
+#endif
+    }
+
+private:
+    bool ouvert_ = false;
+#if defined(_WIN32)
+    std::string tampon_;
+#else
+    const char* donnees_ = nullptr;
+    std::size_t taille_ = 0;
+#endif
+};
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Index inversé des trigrammes (suites de 3 octets) des descriptions.
+// Une description qui contient un motif contient aussi chacun de ses
+// trigrammes : l'intersection de leurs listes donne un petit ensemble de
+// candidats, à vérifier ensuite avec find. Les listes contiennent des ids,
+// triés, qui ne changent pas quand la table est compactée ou triée.
+//
+// Une suppression ne touche pas aux listes (retirer un id d'une longue
+// liste coûterait un parcours) : l'id devient un candidat mort, écarté à
+// la vérification. On reconstruit l'index quand les morts sont trop nombreux.
+class IndexTrigrammes {
+public:
+    void vider() {
+        listes_.clear();
+        nbTextes_ = 0;
+        nbRetires_ = 0;
+    }
+
+    // `parcourir(f)` appelle f(id, texte) pour chaque texte, dans n'importe
+    // quel ordre. Deux passes : on compte d'abord la taille de chaque liste
+    // pour l'allouer une seule fois, puis on la remplit et on la trie.
+    template <typename ParcourirTextes>
+    void construire(ParcourirTextes&& parcourir) {
+        vider();
+        std::vector<std::uint32_t> cles;
+        std::unordered_map<std::uint32_t, std::size_t> tailles;
+        parcourir([&](int, std::string_view texte) {
+            clesDistinctes(texte, cles);
+            for (const auto cle : cles) {
+                ++tailles[cle];
+            }
+        });
+        listes_.reserve(tailles.size());
+        for (const auto& [cle, taille] : tailles) {
+            listes_[cle].reserve(taille);
+        }
+        parcourir([&](int id, std::string_view texte) {
+            clesDistinctes(texte, cles);
+            for (const auto cle : cles) {
+                listes_[cle].push_back(id);
+            }
+            ++nbTextes_;
+        });
+        for (auto& [cle, liste] : listes_) {
+            std::sort(liste.begin(), liste.end());
+        }
+    }
+
+    void ajouter(int id, std::string_view texte) {
+        std::vector<std::uint32_t> cles;
+        ajouter(id, texte, cles);
+    }
+
+    // `parcourir(f)` appelle f(id, texte) pour chaque texte à ajouter ; un
+    // seul tampon de clés sert à tous.
+    template <typename ParcourirTextes>
+    void ajouterTous(ParcourirTextes&& parcourir) {
+        std::vector<std::uint32_t> cles;
+        parcourir([&](int id, std::string_view texte) { ajouter(id, texte, cles); });
+    }
+
+    void retirer() {
+        ++nbRetires_;
+    }
+
+    // Ids morts (supprimés mais encore dans les listes) / ids indexés.
+    std::size_t nbRetires() const {
+        return nbRetires_;
+    }
+    std::size_t nbTextes() const {
+        return nbTextes_;
+    }
+
+    // Ids triés dont le texte contient peut-être `motif`, ou rien si le
+    // motif est trop court (moins de 3 octets) pour être cherché dans l'index.
+    std::optional<std::vector<int>> candidats(std::string_view motif) const {
+        if (motif.size() < 3) {
+            return std::nullopt;
+        }
+        std::vector<std::uint32_t> cles;
+        clesDistinctes(motif, cles);
+        std::vector<const std::vector<int>*> listes;
+        for (const auto cle : cles) {
+            const auto it = listes_.find(cle);
+            if (it == listes_.end()) {
+                return std::vector<int>{};
+            }
+            listes.push_back(&it->second);
+        }
+        // On part de la liste la plus courte : le résultat ne peut que rétrécir.
+        std::sort(listes.begin(), listes.end(),
+                  [](const auto* a, const auto* b) { return a->size() < b->size(); });
+        std::vector<int> resultat = *listes.front();
+        std::vector<int> suivant;
+        for (std::size_t l = 1; l < listes.size() && !resultat.empty(); ++l) {
+            const auto& liste = *listes[l];
+            suivant.clear();
+            if (resultat.size() * 16 < liste.size()) {
+                // Peu de candidats face à une longue liste : recherche dichotomique.
+                std::copy_if(resultat.begin(), resultat.end(), std::back_inserter(suivant),
+                             [&liste](int id) {
+                                 return std::binary_search(liste.begin(), liste.end(), id);
+                             });
+            } else {
+                std::set_intersection(resultat.begin(), resultat.end(), liste.begin(), liste.end(),
+                                      std::back_inserter(suivant));
+            }
+            resultat.swap(suivant);
+        }
+        return resultat;
+    }
+
+private:
+    static void clesDistinctes(std::string_view texte, std::vector<std::uint32_t>& cles) {
+        cles.clear();
+        for (std::size_t i = 0; i + 3 <= texte.size(); ++i) {
+            cles.push_back(static_cast<std::uint32_t>(static_cast<unsigned char>(texte[i])) << 16 |
+                           static_cast<std::uint32_t>(static_cast<unsigned char>(texte[i + 1])) << 8 |
+                           static_cast<unsigned char>(texte[i + 2]));
+        }
+        std::sort(cles.begin(), cles.end());
+        cles.erase(std::unique(cles.begin(), cles.end()), cles.end());
+    }
+
+    void ajouter(int id, std::string_view texte, std::vector<std::uint32_t>& cles) {
+        clesDistinctes(texte, cles);
+        for (const auto cle : cles) {
+            auto& liste = listes_[cle];
+            // Les nouveaux ids sont croissants : l'insertion se fait presque
+            // toujours en fin de liste.
+            if (liste.empty() || liste.back() < id) {
+                liste.push_back(id);
+            } else {
+                const auto position = std::lower_bound(liste.begin(), liste.end(), id);
+                if (*position != id) {
+                    liste.insert(position, id);
+                }
+            }
+        }
+        ++nbTextes_;
+    }
+
+    std::unordered_map<std::uint32_t, std::vector<int>> listes_;
+    std::size_t nbTextes_ = 0;
+    std::size_t nbRetires_ = 0;
+};
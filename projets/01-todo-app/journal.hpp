@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "fichier_projete.hpp"
+
+// Force l'écriture sur disque d'un fichier déjà fermé, ou d'un dossier
+// (nécessaire sous POSIX pour qu'un rename survive à une coupure).
+inline bool forcerSurDisque(const std::filesystem::path& chemin) {
+#if defined(_WIN32)
+    (void)chemin;
+    return true;
+#else
+    const int descripteur = ::open(chemin.c_str(), O_RDONLY);
+    if (descripteur < 0) {
+        return false;
+    }
+    const bool ok = ::fsync(descripteur) == 0;
+    ::close(descripteur);
+    return ok;
+#endif
+}
+
+// --- Journal d'écriture anticipée (write-ahead log) ---
+// Fichier : en-tête "TODOJRNL" | génération u32 | réservé u32, puis des
+// enregistrements  longueur u32 | somme de contrôle u32 | contenu.
+// La génération relie le journal à l'instantané qu'il complète : un journal
+// d'une autre génération a déjà été intégré à l'instantané et est ignoré.
+namespace journal {
+inline constexpr char magique[8] = {'T', 'O', 'D', 'O', 'J', 'R', 'N', 'L'};
+inline constexpr std::size_t tailleEnTete = 16;
+inline constexpr std::size_t tailleEnTeteEnregistrement = 8;
+
+// FNV-1a 32 bits : suffit pour détecter un enregistrement déchiré.
+inline std::uint32_t sommeControle(std::string_view octets) {
+    std::uint32_t somme = 2166136261u;
+    for (const char c : octets) {
+        somme = (somme ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return somme;
+}
+
+enum class Relecture {
+    Absent,      // pas de journal, ou journal vide
+    Perime,      // journal d'une autre génération : déjà dans l'instantané
+    Invalide,    // ce n'est pas un journal de la todo app
+    Relu
+};
+
+// Appelle `appliquer(contenu)` pour chaque enregistrement valide.
+// `tailleValide` reçoit la taille de la partie saine du fichier : ce qui suit
+// est un enregistrement déchiré par un arrêt brutal, à tronquer.
+template <typename Fonction>
+Relecture relire(const std::filesystem::path& chemin, std::uint32_t generation,
+                 std::size_t& tailleValide, Fonction&& appliquer) {
+    tailleValide = 0;
+    if (!std::filesystem::exists(chemin)) {
+        return Relecture::Absent;
+    }
+    FichierProjete projection(chemin);
+    if (!projection.ouvert()) {
+        return Relecture::Invalide;
+    }
+    std::string_view donnees = projection.contenu();
+    if (donnees.size() < tailleEnTete) {
+        // En-tête incomplet : arrêt pendant la création du journal.
+        return Relecture::Absent;
+    }
+    if (std::memcmp(donnees.data(), magique, sizeof(magique)) != 0) {
+        return Relecture::Invalide;
+    }
+    std::uint32_t generationJournal = 0;
+    std::memcpy(&generationJournal, donnees.data() + 8, sizeof(generationJournal));
+    if (generationJournal != generation) {
+        return Relecture::Perime;
+    }
+
+    std::size_t position = tailleEnTete;
+    while (donnees.size() - position >= tailleEnTeteEnregistrement) {
+        std::uint32_t longueur = 0;
+        std::uint32_t somme = 0;
+        std::memcpy(&longueur, donnees.data() + position, sizeof(longueur));
+        std::memcpy(&somme, donnees.data() + position + 4, sizeof(somme));
+        const std::size_t debut = position + tailleEnTeteEnregistrement;
+        if (longueur > donnees.size() - debut) {
+            break;
+        }
+        const auto contenu = donnees.substr(debut, longueur);
+        if (sommeControle(contenu) != somme) {
+            break;
+        }
+        appliquer(contenu);
+        position = debut + longueur;
+    }
+    tailleValide = position;
+    return Relecture::Relu;
+}
+} // namespace journal
+
+// Ajout en fin de journal. Les enregistrements sont accumulés en mémoire et
+// écrits + synchronisés (fsync) par lots : un arrêt brutal perd au plus le
+// lot en cours, jamais ce qui a déjà été synchronisé.
+class Journal {
+public:
+    static constexpr std::size_t enregistrementsParLot = 64;
+
+    // Ouvre le journal en ajout ; `nouveau` le recrée vide pour `generation`.
+    bool ouvrir(const std::filesystem::path& chemin, std::uint32_t generation, bool nouveau) {
+        fermer();
+        echec_ = false;
+        enAttente_ = 0;
+        tampon_.clear();
+        fichier_ = std::fopen(chemin.string().c_str(), nouveau ? "wb" : "ab");
+        if (fichier_ == nullptr) {
+            return false;
+        }
+        if (nouveau) {
+            char enTete[journal::tailleEnTete] = {};
+            std::memcpy(enTete, journal::magique, sizeof(journal::magique));
+            std::memcpy(enTete + 8, &generation, sizeof(generation));
+            tampon_.assign(enTete, sizeof(enTete));
+            if (!synchroniser()) {
+                return false;
+            }
+        }
+        std::error_code erreur;
+        taille_ = std::filesystem::file_size(chemin, erreur);
+        return !erreur;
+    }
+
+    ~Journal() {
+        fermer();
+    }
+
+    Journal() = default;
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    // Un échec d'écriture est mémorisé : synchroniser() le signalera.
+    bool ajouter(std::string_view contenu) {
+        const auto longueur = static_cast<std::uint32_t>(contenu.size());
+        const auto somme = journal::sommeControle(contenu);
+        char enTete[journal::tailleEnTeteEnregistrement];
+        std::memcpy(enTete, &longueur, sizeof(longueur));
+        std::memcpy(enTete + 4, &somme, sizeof(somme));
+        tampon_.append(enTete, sizeof(enTete));
+        tampon_.append(contenu);
+        if (++enAttente_ >= enregistrementsParLot) {
+            return synchroniser();
+        }
+        return !echec_;
+    }
+
+    // Écrit le lot en cours et attend qu'il soit sur disque.
+    bool synchroniser() {
+        if (fichier_ == nullptr || echec_) {
+            return false;
+        }
+        if (!tampon_.empty()) {
+            if (std::fwrite(tampon_.data(), 1, tampon_.size(), fichier_) != tampon_.size()) {
+                echec_ = true;
+                return false;
+            }
+            taille_ += tampon_.size();
+            tampon_.clear();
+        }
+        enAttente_ = 0;
+        echec_ = std::fflush(fichier_) != 0 || !forcerEcriture();
+        return !echec_;
+    }
+
+    // Taille sur disque, lot en attente compris.
+    std::size_t taille() const {
+        return taille_ + tampon_.size();
+    }
+
+    bool ouvert() const {
+        return fichier_ != nullptr;
+    }
+
+    void fermer() {
+        if (fichier_ != nullptr) {
+            synchroniser();
+            std::fclose(fichier_);
+            fichier_ = nullptr;
+        }
+    }
+
+private:
+    bool forcerEcriture() {
+#if defined(_WIN32)
+        return _commit(_fileno(fichier_)) == 0;
+#elif defined(__linux__)
+        return ::fdatasync(::fileno(fichier_)) == 0;
+#else
+        return ::fsync(::fileno(fichier_)) == 0;
+#endif
+    }
+
+    std::FILE* fichier_ = nullptr;
+    std::string tampon_;
+    std::size_t enAttente_ = 0;
+    std::size_t taille_ = 0;
+    bool echec_ = false;
+};
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "taches.hpp"
+
+// Une version figée des tâches : des morceaux d'au plus tailleMorceau
+// lignes, rangés par ids croissants. Une version publiée n'est plus jamais
+// modifiée, et un lecteur qui la garde voit le même état jusqu'au bout,
+// quelles que soient les écritures qui suivent.
+class VersionTaches {
+public:
+    static constexpr std::size_t tailleMorceau = 1024;
+
+    // Croît de 1 à chaque lot appliqué.
+    std::uint64_t numero() const {
+        return numero_;
+    }
+    std::size_t taille() const {
+        return taille_;
+    }
+
+    // La vue reste valable tant que la version est gardée.
+    std::optional<Tache> trouver(int id) const {
+        const auto morceau = localiser(id);
+        if (!morceau) {
+            return std::nullopt;
+        }
+        const auto& table = *morceaux_[*morceau];
+        const auto ligne = ligneDe(table, id);
+        if (!ligne) {
+            return std::nullopt;
+        }
+        return table.ligne(*ligne);
+    }
+
+    // Par ids croissants (l'ordre d'insertion).
+    template <typename Fonction>
+    void pourChaqueTache(Fonction&& fonction) const {
+        for (const auto& table : morceaux_) {
+            for (std::size_t i = 0; i < table->nbLignes(); ++i) {
+                if (!table->estLibre(i)) {
+                    fonction(table->ligne(i));
+                }
+            }
+        }
+    }
+
+    std::array<std::size_t, 3> compterParStatut() const {
+        std::array<std::size_t, 3> total{};
+        for (const auto& table : morceaux_) {
+            const auto comptes = table->compterParStatut();
+            for (std::size_t s = 0; s < total.size(); ++s) {
+                total[s] += comptes[s];
+            }
+        }
+        return total;
+    }
+    // Ids (et non numéros de ligne : une version n'a pas de lignes globales).
+    std::vector<int> filtrerParStatut(Statut statut) const {
+        std::vector<int> ids;
+        for (const auto& table : morceaux_) {
+            for (const auto ligne : table->selectionnerStatut(statut)) {
+                ids.push_back(table->colonnes().ids[ligne]);
+            }
+        }
+        return ids;
+    }
+    std::vector<int> rechercherMotCle(std::string_view motCle) const {
+        std::vector<int> ids;
+        pourChaqueTache([&](const Tache& t) {
+            if (t.description.find(motCle) != std::string_view::npos) {
+                ids.push_back(t.id);
+            }
+        });
+        return ids;
+    }
+
+private:
+    friend class MagasinConcurrent;
+
+    // Le morceau qui contiendrait `id` : le dernier dont le premier id est
+    // inférieur ou égal.
+    std::optional<std::size_t> localiser(int id) const {
+        const auto it = std::upper_bound(premiersIds_.begin(), premiersIds_.end(), id);
+        if (it == premiersIds_.begin()) {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(it - premiersIds_.begin() - 1);
+    }
+    // Dans un morceau, les ids sont croissants : recherche dichotomique.
+    static std::optional<std::size_t> ligneDe(const TableTaches& table, int id) {
+        const auto& ids = table.colonnes().ids;
+        const auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        const auto ligne = static_cast<std::size_t>(it - ids.begin());
+        if (it == ids.end() || *it != id || table.estLibre(ligne)) {
+            return std::nullopt;
+        }
+        return ligne;
+    }
+
+    std::vector<std::shared_ptr<const TableTaches>> morceaux_;
+    std::vector<int> premiersIds_;
+    std::size_t taille_ = 0;
+    int prochainId_ = 1;
+    std::uint64_t numero_ = 0;
+};
+
+// Magasin de tâches partagé entre threads, à isolation par instantané.
+// Un lecteur prend la version courante (instantane()) et la lit sans
+// verrou. Un écrivain applique un lot en copiant seulement les morceaux
+// qu'il touche (copie sur écriture), puis publie la nouvelle version d'un
+// seul échange de pointeur : les lecteurs ne l'attendent jamais, et une
+// ancienne version disparaît avec son dernier lecteur.
+// Les écrivains passent l'un après l'autre.
+class MagasinConcurrent {
+public:
+    MagasinConcurrent() : version_(std::make_shared<const VersionTaches>()) {}
+
+    // Reprend les tâches de `source`, rangées par id.
+    explicit MagasinConcurrent(const GestionnaireTaches& source) {
+        const auto& table = source.table();
+        const auto& ids = table.colonnes().ids;
+        std::vector<std::size_t> lignes;
+        lignes.reserve(source.taille());
+        for (std::size_t i = 0; i < table.nbLignes(); ++i) {
+            if (!table.estLibre(i)) {
+                lignes.push_back(i);
+            }
+        }
+        std::sort(lignes.begin(), lignes.end(),
+                  [&ids](std::size_t a, std::size_t b) { return ids[a] < ids[b]; });
+
+        auto version = std::make_shared<VersionTaches>();
+        for (std::size_t debut = 0; debut < lignes.size(); debut += VersionTaches::tailleMorceau) {
+            const std::size_t fin = std::min(lignes.size(), debut + VersionTaches::tailleMorceau);
+            std::size_t octets = 0;
+            for (std::size_t k = debut; k < fin; ++k) {
+                octets += table.colonnes().longueursDescription[lignes[k]];
+            }
+            auto morceau = std::make_shared<TableTaches>();
+            morceau->reserver(fin - debut, octets, 0);
+            for (std::size_t k = debut; k < fin; ++k) {
+                const Tache t = table.ligne(lignes[k]);
+                morceau->ajouter(t.id, t.description, t.statut, t.priorite, t.dateEcheance);
+            }
+            version->premiersIds_.push_back(ids[lignes[debut]]);
+            version->morceaux_.push_back(std::move(morceau));
+        }
+        version->taille_ = lignes.size();
+        version->prochainId_ = lignes.empty() ? 1 : ids[lignes.back()] + 1;
+        version_.publier(std::move(version));
+    }
+
+    // La version courante, figée : elle reste lisible même si d'autres
+    // versions sont publiées entre-temps.
+    std::shared_ptr<const VersionTaches> instantane() const {
+        return version_.lire();
+    }
+
+    // Mêmes règles que GestionnaireTaches::appliquer : tout le lot, ou rien.
+    // Les lecteurs voient soit la version d'avant, soit celle d'après.
+    std::optional<std::vector<int>> appliquer(const LotTaches& lot) {
+        std::lock_guard verrou(ecriture_);
+        const auto actuelle = version_.lire();
+        if (!lot.valider(actuelle->prochainId_,
+                         [&actuelle](int id) { return actuelle->trouver(id).has_value(); })) {
+            return std::nullopt;
+        }
+
+        // Seul le tableau des pointeurs de morceaux est recopié ; un morceau
+        // n'est copié (compacté) qu'au premier changement qui le touche.
+        auto suivante = std::make_shared<VersionTaches>(*actuelle);
+        ++suivante->numero_;
+        std::vector<TableTaches*> copies(suivante->morceaux_.size(), nullptr);
+        auto modifiable = [&](std::size_t m, std::size_t lignesEnPlus,
+                              std::size_t octetsEnPlus) -> TableTaches& {
+            if (copies[m] == nullptr) {
+                auto copie = std::make_shared<TableTaches>(
+                    suivante->morceaux_[m]->copieCompacte(lignesEnPlus, octetsEnPlus));
+                copies[m] = copie.get();
+                suivante->morceaux_[m] = std::move(copie);
+            }
+            return *copies[m];
+        };
+
+        std::vector<int> ids;
+        ids.reserve(lot.nbAjouts_);
+        std::size_t ajoutsRestants = lot.nbAjouts_;
+        std::size_t octetsRestants = lot.textes_.size();
+        for (const auto& operation : lot.operations_) {
+            if (operation.type == LotTaches::Type::Ajout) {
+                // Place réservée d'après la longueur moyenne des ajouts restants.
+                auto octetsPour = [&](std::size_t lignes) {
+                    return std::min(octetsRestants, lignes * (octetsRestants / ajoutsRestants + 1));
+                };
+                const auto nbMorceaux = suivante->morceaux_.size();
+                if (nbMorceaux == 0 ||
+                    suivante->morceaux_.back()->nbLignes() >= VersionTaches::tailleMorceau) {
+                    const std::size_t lignes = std::min(ajoutsRestants, VersionTaches::tailleMorceau);
+                    auto morceau = std::make_shared<TableTaches>();
+                    morceau->reserver(lignes, octetsPour(lignes), 0);
+                    copies.push_back(morceau.get());
+                    suivante->morceaux_.push_back(std::move(morceau));
+                    suivante->premiersIds_.push_back(suivante->prochainId_);
+                }
+                const std::size_t dernier = suivante->morceaux_.size() - 1;
+                const std::size_t place =
+                    VersionTaches::tailleMorceau - suivante->morceaux_.back()->nbLignes();
+                auto& table = modifiable(dernier, std::min(ajoutsRestants, place),
+                                         octetsPour(std::min(ajoutsRestants, place)));
+                const auto description = lot.description(operation);
+                const int id = suivante->prochainId_++;
+                table.ajouter(id, description, Statut::AFaire,
+                              static_cast<Priorite>(operation.valeur), operation.date);
+                ids.push_back(id);
+                ++suivante->taille_;
+                --ajoutsRestants;
+                octetsRestants -= description.size();
+                continue;
+            }
+            const std::size_t m = *suivante->localiser(operation.id);
+            auto& table = modifiable(m, 0, 0);
+            const std::size_t ligne = *VersionTaches::ligneDe(table, operation.id);
+            if (operation.type == LotTaches::Type::Statut) {
+                table.changerStatut(ligne, static_cast<Statut>(operation.valeur));
+            } else {
+                table.liberer(ligne);
+                --suivante->taille_;
+            }
+        }
+
+        // Les morceaux copiés ont pu changer de premier id ou se vider.
+        std::size_t garde = 0;
+        for (std::size_t m = 0; m < suivante->morceaux_.size(); ++m) {
+            if (copies[m] != nullptr) {
+                const auto comptes = copies[m]->compterParStatut();
+                if (comptes[0] + comptes[1] + comptes[2] == 0) {
+                    continue;
+                }
+                suivante->premiersIds_[m] = copies[m]->colonnes().ids.front();
+            }
+            suivante->morceaux_[garde] = std::move(suivante->morceaux_[m]);
+            suivante->premiersIds_[garde] = suivante->premiersIds_[m];
+            ++garde;
+        }
+        suivante->morceaux_.resize(garde);
+        suivante->premiersIds_.resize(garde);
+
+        version_.publier(std::move(suivante));
+        return ids;
+    }
+
+    std::optional<int> ajouterTache(std::string_view description, Priorite priorite,
+                                    std::string_view dateEcheance) {
+        LotTaches lot;
+        lot.ajouter(description, priorite, dateEcheance);
+        const auto ids = appliquer(lot);
+        return ids ? std::optional<int>(ids->front()) : std::nullopt;
+    }
+    bool changerStatut(int id, Statut statut) {
+        LotTaches lot;
+        lot.changerStatut(id, statut);
+        return appliquer(lot).has_value();
+    }
+    bool supprimerTache(int id) {
+        LotTaches lot;
+        lot.supprimer(id);
+        return appliquer(lot).has_value();
+    }
+
+private:
+    // Le pointeur vers la version courante. Son verrou n'est tenu que le
+    // temps de copier le pointeur, jamais pendant une lecture ou un lot.
+    // (std::atomic<std::shared_ptr> ferait la même chose avec un verrou
+    // interne, mais celui de libstdc++ 12 relâche ce verrou sans ordre
+    // mémoire après une lecture.)
+    class VersionCourante {
+    public:
+        VersionCourante() = default;
+        explicit VersionCourante(std::shared_ptr<const VersionTaches> version)
+            : pointeur_(std::move(version)) {}
+
+        std::shared_ptr<const VersionTaches> lire() const {
+            std::lock_guard verrou(verrou_);
+            return pointeur_;
+        }
+        // L'ancienne version est libérée après le verrou, avec `version`.
+        void publier(std::shared_ptr<const VersionTaches> version) {
+            std::lock_guard verrou(verrou_);
+            pointeur_.swap(version);
+        }
+
+    private:
+        mutable std::mutex verrou_;
+        std::shared_ptr<const VersionTaches> pointeur_;
+    };
+
+    std::mutex ecriture_;
+    VersionCourante version_;
+};
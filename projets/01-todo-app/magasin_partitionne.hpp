@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "parallele.hpp"
+#include "taches.hpp"
+
+// Fusionne des listes déjà triées selon `avant` : un tas des têtes de
+// liste, O(n log k) pour k listes.
+template <typename T, typename Avant>
+std::vector<T> fusionnerTriees(const std::vector<std::vector<T>>& listes, Avant avant) {
+    using Tete = std::pair<std::size_t, std::size_t>;    // liste, position
+    auto apres = [&](const Tete& a, const Tete& b) {
+        return avant(listes[b.first][b.second], listes[a.first][a.second]);
+    };
+    std::priority_queue<Tete, std::vector<Tete>, decltype(apres)> tetes(apres);
+    std::size_t total = 0;
+    for (std::size_t l = 0; l < listes.size(); ++l) {
+        total += listes[l].size();
+        if (!listes[l].empty()) {
+            tetes.push({l, 0});
+        }
+    }
+    std::vector<T> resultat;
+    resultat.reserve(total);
+    while (!tetes.empty()) {
+        const auto [l, position] = tetes.top();
+        tetes.pop();
+        resultat.push_back(listes[l][position]);
+        if (position + 1 < listes[l].size()) {
+            tetes.push({l, position + 1});
+        }
+    }
+    return resultat;
+}
+
+// Tâches réparties en partitions indépendantes, chacune un
+// GestionnaireTaches avec son propre verrou : des threads qui écrivent
+// dans des partitions différentes ne s'attendent pas.
+//
+// Pas de compteur d'ids partagé : chaque partition numérote ses tâches
+// 1, 2, 3... et ces ids locaux sont traduits en ids globaux par blocs de
+// tailleBlocIds. La partition p reçoit les blocs p, p + n, p + 2n... ;
+// l'id global suffit donc à retrouver la partition.
+//
+// Une requête sur toutes les partitions les interroge en parallèle, puis
+// fusionne leurs résultats déjà triés. Chaque partition est lue dans un
+// état cohérent, mais pas forcément au même instant que les autres.
+class MagasinPartitionne {
+public:
+    static constexpr int tailleBlocIds = 1024;
+
+    explicit MagasinPartitionne(std::size_t nbPartitions = nombreThreadsParDefaut()) {
+        partitions_.resize(std::max<std::size_t>(1, nbPartitions));
+        for (auto& partition : partitions_) {
+            partition = std::make_unique<Partition>();
+        }
+    }
+
+    std::size_t nbPartitions() const {
+        return partitions_.size();
+    }
+
+    // Chaque thread écrit ses ajouts dans « sa » partition.
+    std::optional<int> ajouterTache(std::string_view description, Priorite priorite,
+                                    std::string_view dateEcheance) {
+        const std::size_t p = numeroDuThread() % nbPartitions();
+        std::lock_guard verrou(partitions_[p]->verrou);
+        const auto id = partitions_[p]->taches.ajouterTache(description, priorite, dateEcheance);
+        return id ? std::optional<int>(idGlobal(p, *id)) : std::nullopt;
+    }
+    bool changerStatut(int id, Statut statut) {
+        const auto local = idLocal(id);
+        if (!local) {
+            return false;
+        }
+        std::lock_guard verrou(partitions_[local->first]->verrou);
+        return partitions_[local->first]->taches.changerStatut(local->second, statut);
+    }
+    bool supprimerTache(int id) {
+        const auto local = idLocal(id);
+        if (!local) {
+            return false;
+        }
+        std::lock_guard verrou(partitions_[local->first]->verrou);
+        return partitions_[local->first]->taches.supprimerTache(local->second);
+    }
+    // Appelle `fonction(tache)` sous le verrou de la partition, la vue ne
+    // restant valable que pendant l'appel ; faux si l'id est inconnu.
+    template <typename Fonction>
+    bool consulter(int id, Fonction&& fonction) const {
+        const auto local = idLocal(id);
+        if (!local) {
+            return false;
+        }
+        std::lock_guard verrou(partitions_[local->first]->verrou);
+        auto tache = partitions_[local->first]->taches.trouver(local->second);
+        if (!tache) {
+            return false;
+        }
+        tache->id = id;
+        fonction(*tache);
+        return true;
+    }
+
+    std::size_t taille() const {
+        std::size_t total = 0;
+        for (const auto& partition : partitions_) {
+            std::lock_guard verrou(partition->verrou);
+            total += partition->taches.taille();
+        }
+        return total;
+    }
+    void activerIndexRecherche(bool actif = true) {
+        for (auto& partition : partitions_) {
+            std::lock_guard verrou(partition->verrou);
+            partition->taches.activerIndexRecherche(actif);
+        }
+    }
+    void activerVuesTriees(bool actif = true) {
+        for (auto& partition : partitions_) {
+            std::lock_guard verrou(partition->verrou);
+            partition->taches.activerVuesTriees(actif);
+        }
+    }
+
+    // Ids globaux, croissants.
+    std::vector<int> filtrerParStatut(Statut statut) const {
+        return rassemblerIds([statut](const GestionnaireTaches& taches) {
+            return taches.filtrerParStatut(statut);
+        });
+    }
+    std::vector<int> rechercherMotCle(std::string_view motCle) const {
+        return rassemblerIds([motCle](const GestionnaireTaches& taches) {
+            return taches.rechercherMotCle(motCle);
+        });
+    }
+    std::array<std::size_t, 3> compterParStatut() const {
+        std::array<std::size_t, 3> total{};
+        for (const auto& partition : partitions_) {
+            std::lock_guard verrou(partition->verrou);
+            const auto comptes = partition->taches.compterParStatut();
+            for (std::size_t s = 0; s < total.size(); ++s) {
+                total[s] += comptes[s];
+            }
+        }
+        return total;
+    }
+
+    // Liste dans l'ordre demandé, avec les mêmes règles que
+    // GestionnaireTaches::pourChaqueTache (Insertion devient l'ordre des
+    // ids globaux) : chaque partition donne ses tâches déjà triées, puis
+    // les listes sont fusionnées. Toutes les partitions restent
+    // verrouillées pendant les appels à `fonction`.
+    template <typename Fonction>
+    void pourChaqueTache(Ordre ordre, Fonction&& fonction) const {
+        std::vector<std::unique_lock<std::mutex>> verrous;
+        verrous.reserve(nbPartitions());
+        for (const auto& partition : partitions_) {
+            verrous.emplace_back(partition->verrou);
+        }
+        std::vector<std::vector<Tache>> listes(nbPartitions());
+        executerEnParallele(nbPartitions(), nombreThreadsParDefaut(), [&](std::size_t p) {
+            partitions_[p]->taches.pourChaqueTache(ordre, [&](const Tache& t) {
+                listes[p].push_back(t);
+                listes[p].back().id = idGlobal(p, t.id);
+            });
+        });
+        for (const Tache& tache : fusionnerTriees(listes, avantDans(ordre))) {
+            fonction(tache);
+        }
+    }
+
+    // Ids globaux des `k` premières tâches dans l'ordre `ordre` (mêmes
+    // règles que pourChaqueTache) parmi celles que retient `filtre` : chaque
+    // partition calcule son propre GestionnaireTaches::topK en parallèle, et
+    // seules ces k meilleures par partition sont fusionnées. `filtre` reçoit
+    // la tâche avec son id global et peut être appelé par plusieurs threads
+    // à la fois.
+    template <typename Filtre>
+    std::vector<int> topK(std::size_t k, Ordre ordre, Filtre&& filtre) const {
+        std::vector<std::vector<Tache>> listes(nbPartitions());
+        executerEnParallele(nbPartitions(), nombreThreadsParDefaut(), [&](std::size_t p) {
+            std::lock_guard verrou(partitions_[p]->verrou);
+            const auto& taches = partitions_[p]->taches;
+            const auto retenir = [&](Tache tache) {
+                tache.id = idGlobal(p, tache.id);
+                return filtre(tache);
+            };
+            for (const auto ligne : taches.topK(k, ordre, retenir)) {
+                Tache tache = taches.table().ligne(ligne);
+                tache.id = idGlobal(p, tache.id);
+                tache.description = {};    // ne survivrait pas au verrou
+                listes[p].push_back(tache);
+            }
+        });
+        std::vector<int> ids;
+        for (const Tache& tache : fusionnerTriees(listes, avantDans(ordre))) {
+            if (ids.size() == k) {
+                break;
+            }
+            ids.push_back(tache.id);
+        }
+        return ids;
+    }
+    std::vector<int> topK(std::size_t k, Ordre ordre) const {
+        return topK(k, ordre, [](const Tache&) { return true; });
+    }
+
+private:
+    struct Partition {
+        mutable std::mutex verrou;
+        GestionnaireTaches taches;
+    };
+
+    // Numéro donné à chaque thread à son premier ajout : des threads lancés
+    // à la suite tombent dans des partitions différentes. (Le hachage de
+    // std::thread::id ne convient pas : c'est souvent une adresse alignée,
+    // donc le même reste modulo n pour tous les threads.)
+    static std::size_t numeroDuThread() {
+        static std::atomic<std::size_t> suivant = 0;
+        thread_local const std::size_t numero = suivant++;
+        return numero;
+    }
+
+    // Ordre des listes de chaque partition : à égalité, l'id global
+    // départage, comme l'id local le fait dans une partition.
+    static auto avantDans(Ordre ordre) {
+        return [ordre](const Tache& a, const Tache& b) {
+            if (ordre == Ordre::Priorite && a.priorite != b.priorite) {
+                return a.priorite > b.priorite;
+            }
+            if (ordre == Ordre::Date && a.dateEcheance != b.dateEcheance) {
+                return a.dateEcheance < b.dateEcheance;
+            }
+            return a.id < b.id;
+        };
+    }
+
+    int idGlobal(std::size_t partition, int idLocal) const {
+        const int rang = idLocal - 1;
+        const int bloc = rang / tailleBlocIds * static_cast<int>(nbPartitions()) +
+                         static_cast<int>(partition);
+        return bloc * tailleBlocIds + rang % tailleBlocIds + 1;
+    }
+    // Partition et id local d'un id global, ou rien pour un id impossible.
+    std::optional<std::pair<std::size_t, int>> idLocal(int id) const {
+        if (id <= 0) {
+            return std::nullopt;
+        }
+        const int rang = id - 1;
+        const int bloc = rang / tailleBlocIds;
+        const int n = static_cast<int>(nbPartitions());
+        return std::pair{static_cast<std::size_t>(bloc % n),
+                         bloc / n * tailleBlocIds + rang % tailleBlocIds + 1};
+    }
+
+    // Une partition garde ses tâches dans l'ordre de ses ids locaux, donc
+    // ses résultats sont déjà croissants en ids globaux.
+    template <typename Requete>
+    std::vector<int> rassemblerIds(Requete&& requete) const {
+        std::vector<std::vector<int>> listes(nbPartitions());
+        executerEnParallele(nbPartitions(), nombreThreadsParDefaut(), [&](std::size_t p) {
+            std::lock_guard verrou(partitions_[p]->verrou);
+            const auto& taches = partitions_[p]->taches;
+            const auto& ids = taches.table().colonnes().ids;
+            for (const auto ligne : requete(taches)) {
+                listes[p].push_back(idGlobal(p, ids[ligne]));
+            }
+        });
+        return fusionnerTriees(listes, std::less<int>{});
+    }
+
+    std::vector<std::unique_ptr<Partition>> partitions_;
+};
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Noyaux de parcours d'une colonne d'octets (statuts, priorités).
+// Trois versions donnent le même résultat : AVX2 (32 octets par
+// instruction), SSE2 (16 octets) et scalaire. La meilleure est choisie à
+// l'exécution selon le processeur ; hors x86 (ou sous MSVC), seule la
+// version scalaire existe.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TODO_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace simd {
+
+enum class Jeu {
+    Scalaire,
+    SSE2,
+    AVX2
+};
+
+inline Jeu jeuDisponible() {
+#if defined(TODO_SIMD_X86)
+    static const Jeu jeu = __builtin_cpu_supports("avx2")   ? Jeu::AVX2
+                           : __builtin_cpu_supports("sse2") ? Jeu::SSE2
+                                                            : Jeu::Scalaire;
+    return jeu;
+#else
+    return Jeu::Scalaire;
+#endif
+}
+
+// Numéros des lignes d'une table (vecteur de sélection).
+using Selection = std::vector<std::uint32_t>;
+
+namespace detail {
+
+// La sélection grandit par blocs : on écrit directement dans le vecteur
+// au lieu d'un push_back par ligne retenue.
+inline std::uint32_t* reserverBloc(Selection& selection, std::size_t taille, std::size_t bloc) {
+    if (selection.size() < taille + bloc) {
+        selection.resize(std::max(selection.size() * 2, taille + bloc));
+    }
+    return selection.data() + taille;
+}
+
+inline std::size_t selectionnerScalaire(const std::uint8_t* octets, std::size_t debut,
+                                        std::size_t n, std::uint8_t valeur,
+                                        Selection& selection, std::size_t taille) {
+    for (std::size_t i = debut; i < n; ++i) {
+        if (octets[i] == valeur) {
+            *reserverBloc(selection, taille, 1) = static_cast<std::uint32_t>(i);
+            ++taille;
+        }
+    }
+    return taille;
+}
+
+template <std::size_t K>
+void compterScalaire(const std::uint8_t* octets, std::size_t debut, std::size_t n,
+                     std::uint8_t premier, std::array<std::size_t, K>& comptes) {
+    for (std::size_t i = debut; i < n; ++i) {
+        const auto rang = static_cast<std::uint8_t>(octets[i] - premier);
+        if (rang < K) {
+            ++comptes[rang];
+        }
+    }
+}
+
+#if defined(TODO_SIMD_X86)
+// Transforme un masque de bits (un bit par octet égal) en numéros de ligne.
+inline std::size_t ecrireMasque(std::uint32_t masque, std::size_t base, std::uint32_t* sortie) {
+    std::size_t k = 0;
+    while (masque != 0) {
+        sortie[k++] = static_cast<std::uint32_t>(base + static_cast<unsigned>(__builtin_ctz(masque)));
+        masque &= masque - 1;
+    }
+    return k;
+}
+
+__attribute__((target("sse2"))) inline std::size_t selectionnerSSE2(
+    const std::uint8_t* octets, std::size_t n, std::uint8_t valeur, Selection& selection) {
+    const __m128i cible = _mm_set1_epi8(static_cast<char>(valeur));
+    std::size_t taille = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i bloc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octets + i));
+        const auto masque = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bloc, cible)));
+        if (masque != 0) {
+            taille += ecrireMasque(masque, i, reserverBloc(selection, taille, 16));
+        }
+    }
+    return selectionnerScalaire(octets, i, n, valeur, selection, taille);
+}
+
+__attribute__((target("avx2"))) inline std::size_t selectionnerAVX2(
+    const std::uint8_t* octets, std::size_t n, std::uint8_t valeur, Selection& selection) {
+    const __m256i cible = _mm256_set1_epi8(static_cast<char>(valeur));
+    std::size_t taille = 0;
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i bloc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(octets + i));
+        const auto masque =
+            static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bloc, cible)));
+        if (masque != 0) {
+            taille += ecrireMasque(masque, i, reserverBloc(selection, taille, 32));
+        }
+    }
+    return selectionnerScalaire(octets, i, n, valeur, selection, taille);
+}
+
+// Un compteur d'un octet par position et par valeur : cmpeq vaut -1 sur
+// une égalité, on le soustrait. Avant que les octets ne débordent (255
+// blocs), _mm_sad_epu8 les additionne dans les totaux 64 bits.
+template <std::size_t K>
+__attribute__((target("sse2"))) void compterSSE2(const std::uint8_t* octets, std::size_t n,
+                                                 std::uint8_t premier,
+                                                 std::array<std::size_t, K>& comptes) {
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 0;
+    while (i + 16 <= n) {
+        __m128i compteurs[K];
+        __m128i cibles[K];
+        for (std::size_t v = 0; v < K; ++v) {
+            compteurs[v] = zero;
+            cibles[v] = _mm_set1_epi8(static_cast<char>(premier + v));
+        }
+        for (std::size_t tour = 0; tour < 255 && i + 16 <= n; ++tour, i += 16) {
+            const __m128i bloc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octets + i));
+            for (std::size_t v = 0; v < K; ++v) {
+                compteurs[v] = _mm_sub_epi8(compteurs[v], _mm_cmpeq_epi8(bloc, cibles[v]));
+            }
+        }
+        for (std::size_t v = 0; v < K; ++v) {
+            const __m128i sommes = _mm_sad_epu8(compteurs[v], zero);
+            comptes[v] += static_cast<std::size_t>(_mm_cvtsi128_si32(sommes)) +
+                          static_cast<std::size_t>(_mm_extract_epi16(sommes, 4));
+        }
+    }
+    compterScalaire(octets, i, n, premier, comptes);
+}
+
+template <std::size_t K>
+__attribute__((target("avx2"))) void compterAVX2(const std::uint8_t* octets, std::size_t n,
+                                                 std::uint8_t premier,
+                                                 std::array<std::size_t, K>& comptes) {
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t i = 0;
+    while (i + 32 <= n) {
+        __m256i compteurs[K];
+        __m256i cibles[K];
+        for (std::size_t v = 0; v < K; ++v) {
+            compteurs[v] = zero;
+            cibles[v] = _mm256_set1_epi8(static_cast<char>(premier + v));
+        }
+        for (std::size_t tour = 0; tour < 255 && i + 32 <= n; ++tour, i += 32) {
+            const __m256i bloc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(octets + i));
+            for (std::size_t v = 0; v < K; ++v) {
+                compteurs[v] = _mm256_sub_epi8(compteurs[v], _mm256_cmpeq_epi8(bloc, cibles[v]));
+            }
+        }
+        for (std::size_t v = 0; v < K; ++v) {
+            const __m256i sommes = _mm256_sad_epu8(compteurs[v], zero);
+            comptes[v] += static_cast<std::size_t>(_mm256_extract_epi16(sommes, 0)) +
+                          static_cast<std::size_t>(_mm256_extract_epi16(sommes, 4)) +
+                          static_cast<std::size_t>(_mm256_extract_epi16(sommes, 8)) +
+                          static_cast<std::size_t>(_mm256_extract_epi16(sommes, 12));
+        }
+    }
+    compterScalaire(octets, i, n, premier, comptes);
+}
+#endif
+
+} // namespace detail
+
+// Numéros des lignes dont l'octet vaut `valeur`, dans l'ordre croissant.
+inline Selection selectionnerEgal(const std::uint8_t* octets, std::size_t n, std::uint8_t valeur,
+                                  Jeu jeu = jeuDisponible()) {
+    Selection selection;
+    std::size_t taille = 0;
+    switch (jeu) {
+#if defined(TODO_SIMD_X86)
+        case Jeu::AVX2:
+            taille = detail::selectionnerAVX2(octets, n, valeur, selection);
+            break;
+        case Jeu::SSE2:
+            taille = detail::selectionnerSSE2(octets, n, valeur, selection);
+            break;
+#endif
+        default:
+            taille = detail::selectionnerScalaire(octets, 0, n, valeur, selection, 0);
+            break;
+    }
+    selection.resize(taille);
+    return selection;
+}
+
+// Histogramme des valeurs premier, premier + 1, ..., premier + K - 1 en une
+// seule passe ; les autres valeurs sont ignorées.
+template <std::size_t K>
+std::array<std::size_t, K> compterValeurs(const std::uint8_t* octets, std::size_t n,
+                                          std::uint8_t premier, Jeu jeu = jeuDisponible()) {
+    std::array<std::size_t, K> comptes{};
+    switch (jeu) {
+#if defined(TODO_SIMD_X86)
+        case Jeu::AVX2:
+            detail::compterAVX2(octets, n, premier, comptes);
+            break;
+        case Jeu::SSE2:
+            detail::compterSSE2(octets, n, premier, comptes);
+            break;
+#endif
+        default:
+            detail::compterScalaire(octets, 0, n, premier, comptes);
+            break;
+    }
+    return comptes;
+}
+
+} // namespace simd
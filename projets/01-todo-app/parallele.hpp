@@ -0,0 +1,57 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+inline unsigned nombreThreadsParDefaut() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Exécute travail(0) ... travail(nbTravaux - 1) sur un petit pool de
+// nbThreads threads. Chaque thread prend le prochain indice libre, ce qui
+// équilibre la charge quand les travaux n'ont pas tous la même durée.
+// La première exception levée par un travail est relancée dans l'appelant.
+template <typename Travail>
+void executerEnParallele(std::size_t nbTravaux, unsigned nbThreads, Travail&& travail) {
+    nbThreads = static_cast<unsigned>(std::min<std::size_t>(std::max(1u, nbThreads), nbTravaux));
+    if (nbThreads <= 1) {
+        for (std::size_t i = 0; i < nbTravaux; ++i) {
+            travail(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> prochain{0};
+    std::exception_ptr erreur;
+    std::mutex verrouErreur;
+    auto boucle = [&] {
+        for (std::size_t i = prochain++; i < nbTravaux; i = prochain++) {
+            try {
+                travail(i);
+            } catch (...) {
+                std::lock_guard verrou(verrouErreur);
+                if (!erreur) {
+                    erreur = std::current_exception();
+                }
+                prochain = nbTravaux;
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(nbThreads - 1);
+        for (unsigned t = 1; t < nbThreads; ++t) {
+            threads.emplace_back(boucle);
+        }
+        boucle();
+    }
+    if (erreur) {
+        std::rethrow_exception(erreur);
+    }
+}
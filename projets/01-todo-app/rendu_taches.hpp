@@ -0,0 +1,95 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "table_taches.hpp"
+
+// Textes des énumérations : des tables statiques, aucune chaîne construite
+// à l'appel.
+inline constexpr std::array<std::string_view, 3> textesStatut = {"A_FAIRE", "EN_COURS",
+                                                                 "TERMINEE"};
+inline constexpr std::array<std::string_view, 3> textesPriorite = {"BASSE", "MOYENNE", "HAUTE"};
+
+inline std::string_view versTexte(Statut statut) {
+    const auto i = static_cast<std::size_t>(statut);
+    return i < textesStatut.size() ? textesStatut[i] : textesStatut[0];
+}
+inline std::string_view versTexte(Priorite priorite) {
+    const auto i = static_cast<std::size_t>(priorite) - 1;
+    return i < textesPriorite.size() ? textesPriorite[i] : textesPriorite[1];
+}
+
+// Affichage des tâches par blocs : chaque ligne est formatée dans un tampon
+// réutilisé, qui part vers le flux dès qu'il dépasse tailleBloc (et à la
+// destruction). Après les premières lignes, le tampon a atteint sa taille
+// et plus rien n'est alloué.
+//
+// Une ligne : "- [id] description | STATUT | PRIORITE | YYYY-MM-DD", les
+// colonnes complétées à 30, 8 et 7 caractères. La largeur se compte en
+// caractères et non en octets (std::setw comptait les octets, ce qui
+// décalait les descriptions accentuées). Pas de std::format ici : absent
+// de certains compilateurs, il ne compte pas non plus la largeur de la
+// même façon selon la version de la bibliothèque standard.
+class RenduTaches {
+public:
+    static constexpr std::size_t tailleBloc = 64 * 1024;
+
+    explicit RenduTaches(std::ostream& sortie = std::cout) : sortie_(sortie) {}
+    RenduTaches(const RenduTaches&) = delete;
+    RenduTaches& operator=(const RenduTaches&) = delete;
+    ~RenduTaches() {
+        vider();
+    }
+
+    void ajouter(const Tache& tache) {
+        tampon_ += "- [";
+        char nombre[12];
+        tampon_.append(nombre, std::to_chars(nombre, nombre + sizeof(nombre), tache.id).ptr);
+        tampon_ += "] ";
+        colonne(tache.description, 30);
+        tampon_ += " | ";
+        colonne(versTexte(tache.statut), 8);
+        tampon_ += " | ";
+        colonne(versTexte(tache.priorite), 7);
+        tampon_ += " | ";
+        char date[10];
+        tampon_.append(date, ecrireDate(date, tache.dateEcheance));
+        tampon_ += '\n';
+        if (tampon_.size() >= tailleBloc) {
+            vider();
+        }
+    }
+    void ajouter(std::string_view texte) {
+        tampon_ += texte;
+        if (tampon_.size() >= tailleBloc) {
+            vider();
+        }
+    }
+
+    void vider() {
+        sortie_.write(tampon_.data(), static_cast<std::streamsize>(tampon_.size()));
+        tampon_.clear();
+    }
+
+private:
+    // Complète à `largeur` caractères UTF-8 : les octets de continuation
+    // (10xxxxxx) ne comptent pas.
+    void colonne(std::string_view texte, std::size_t largeur) {
+        tampon_ += texte;
+        const auto caracteres = static_cast<std::size_t>(
+            std::count_if(texte.begin(), texte.end(),
+                          [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }));
+        if (caracteres < largeur) {
+            tampon_.append(largeur - caracteres, ' ');
+        }
+    }
+
+    std::ostream& sortie_;
+    std::string tampon_;
+};
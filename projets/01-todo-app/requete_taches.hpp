@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "noyaux_simd.hpp"
+#include "table_taches.hpp"
+
+// Une conjonction de critères (au plus un par colonne : un second appel
+// remplace le premier), puis un décalage et une limite, comme une page
+// de résultats. S'exécute avec GestionnaireTaches::executer.
+class RequeteTaches {
+public:
+    RequeteTaches& statut(Statut statut) {
+        statut_ = statut;
+        return *this;
+    }
+    RequeteTaches& priorite(Priorite priorite) {
+        priorite_ = priorite;
+        return *this;
+    }
+    // Bornes incluses ; les tâches sans échéance ne sont jamais retenues.
+    RequeteTaches& echeanceEntre(DateCompacte debut, DateCompacte fin) {
+        echeance_ = {std::max<DateCompacte>(debut, 1), fin};
+        return *this;
+    }
+    RequeteTaches& motCle(std::string_view motCle) {
+        motCle_ = std::string(motCle);
+        return *this;
+    }
+    RequeteTaches& decaler(std::size_t nombre) {
+        decalage_ = nombre;
+        return *this;
+    }
+    RequeteTaches& limiter(std::size_t nombre) {
+        limite_ = nombre;
+        return *this;
+    }
+
+private:
+    friend class GestionnaireTaches;
+    friend class ResultatRequete;
+
+    std::optional<Statut> statut_;
+    std::optional<Priorite> priorite_;
+    std::optional<std::pair<DateCompacte, DateCompacte>> echeance_;
+    std::optional<std::string> motCle_;
+    std::size_t decalage_ = 0;
+    std::size_t limite_ = std::numeric_limits<std::size_t>::max();
+};
+
+enum class Critere : std::uint8_t { Statut, Priorite, Echeance, MotCle };
+
+// Comment une requête est exécutée : d'où viennent les lignes candidates
+// (acces), puis les critères vérifiés sur chacune, du plus sélectif au
+// moins sélectif (le mot-clé, plus cher à vérifier, passe après à
+// sélectivité voisine).
+struct PlanRequete {
+    enum class Acces : std::uint8_t {
+        Parcours,      // toutes les lignes
+        Statut,        // colonne des statuts (noyau SIMD)
+        Priorite,      // colonne des priorités (noyau SIMD)
+        Echeances,     // vue triée par date
+        Trigrammes     // index des trigrammes
+    };
+    Acces acces = Acces::Parcours;
+    std::vector<Critere> filtres;
+    double lignesEstimees = 0;    // résultats attendus, d'après l'échantillon
+
+    std::string expliquer() const {
+        static constexpr std::string_view acces_[] = {"parcours", "statut", "priorite",
+                                                      "echeances", "trigrammes"};
+        static constexpr std::string_view criteres[] = {"statut", "priorite", "echeance", "motCle"};
+        std::string texte(acces_[static_cast<std::size_t>(acces)]);
+        for (const auto critere : filtres) {
+            texte += " > ";
+            texte += criteres[static_cast<std::size_t>(critere)];
+        }
+        return texte;
+    }
+};
+
+// Sélectivité de chaque critère, estimée sur un échantillon de lignes
+// réparties régulièrement dans la table : le coût ne dépend pas du nombre
+// de tâches, et aucune statistique n'est à tenir à jour à chaque
+// modification. La table est découpée en tailleMax tranches égales (à une
+// ligne près) et chaque tranche fournit sa première ligne occupée : la fin
+// de la table est aussi représentée que le début.
+class EchantillonTaches {
+public:
+    static constexpr std::size_t tailleMax = 1024;
+
+    explicit EchantillonTaches(const TableTaches& table) {
+        const std::size_t n = table.nbLignes();
+        const std::size_t tranches = std::min(n, tailleMax);
+        for (std::size_t k = 0; k < tranches; ++k) {
+            const std::size_t fin = (k + 1) * n / tranches;
+            for (std::size_t i = k * n / tranches; i < fin; ++i) {
+                if (!table.estLibre(i)) {
+                    lignes_.push_back(i);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Part estimée des tâches qui vérifient `critere`, jamais tout à fait
+    // nulle (une valeur absente de l'échantillon peut exister ailleurs).
+    template <typename Verifier>
+    double selectivite(Verifier&& verifier) const {
+        std::size_t retenues = 0;
+        for (const auto ligne : lignes_) {
+            retenues += verifier(ligne);
+        }
+        return (static_cast<double>(retenues) + 0.5) / (static_cast<double>(lignes_.size()) + 1);
+    }
+
+private:
+    std::vector<std::size_t> lignes_;
+};
+
+// Résultat paresseux d'une requête : les lignes candidates ne sont
+// vérifiées qu'au fil du parcours, et le parcours s'arrête à la limite.
+// Les tâches arrivent dans l'ordre de la liste (ordre d'insertion). Les
+// vues Tache restent valables jusqu'à la prochaine modification.
+class ResultatRequete {
+public:
+    class iterateur {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = Tache;
+        using difference_type = std::ptrdiff_t;
+
+        iterateur() = default;
+
+        Tache operator*() const {
+            return resultat_->table_->ligne(resultat_->ligne(position_));
+        }
+        iterateur& operator++() {
+            if (++rendues_ >= resultat_->requete_.limite_) {
+                position_ = resultat_->nbCandidates();
+            } else {
+                avancer(position_ + 1);
+            }
+            return *this;
+        }
+        void operator++(int) {
+            ++*this;
+        }
+        bool operator==(std::default_sentinel_t) const {
+            return position_ >= resultat_->nbCandidates();
+        }
+
+    private:
+        friend class ResultatRequete;
+        explicit iterateur(const ResultatRequete* resultat) : resultat_(resultat) {
+            if (resultat_->requete_.limite_ == 0) {
+                position_ = resultat_->nbCandidates();
+                return;
+            }
+            avancer(0);
+            for (std::size_t i = 0; i < resultat_->requete_.decalage_ && *this != std::default_sentinel;
+                 ++i) {
+                avancer(position_ + 1);
+            }
+        }
+        // Première candidate retenue à partir de `position`.
+        void avancer(std::size_t position) {
+            const std::size_t fin = resultat_->nbCandidates();
+            while (position < fin && !resultat_->retenue(resultat_->ligne(position))) {
+                ++position;
+            }
+            position_ = position;
+        }
+
+        const ResultatRequete* resultat_ = nullptr;
+        std::size_t position_ = 0;
+        std::size_t rendues_ = 0;
+    };
+
+    iterateur begin() const {
+        return iterateur(this);
+    }
+    std::default_sentinel_t end() const {
+        return std::default_sentinel;
+    }
+
+    const PlanRequete& plan() const {
+        return plan_;
+    }
+
+private:
+    friend class GestionnaireTaches;
+
+    ResultatRequete(const TableTaches& table, RequeteTaches requete, PlanRequete plan,
+                    std::optional<simd::Selection> candidates)
+        : table_(&table), requete_(std::move(requete)), plan_(std::move(plan)),
+          candidates_(std::move(candidates)) {}
+
+    // Sans candidates, toutes les lignes de la table le sont.
+    std::size_t nbCandidates() const {
+        return candidates_ ? candidates_->size() : table_->nbLignes();
+    }
+    std::size_t ligne(std::size_t position) const {
+        return candidates_ ? (*candidates_)[position] : position;
+    }
+    bool retenue(std::size_t ligne) const {
+        if (table_->estLibre(ligne)) {
+            return false;
+        }
+        const auto& c = table_->colonnes();
+        for (const auto critere : plan_.filtres) {
+            bool ok = true;
+            switch (critere) {
+                case Critere::Statut:
+                    ok = c.statuts[ligne] == static_cast<std::uint8_t>(*requete_.statut_);
+                    break;
+                case Critere::Priorite:
+                    ok = c.priorites[ligne] == static_cast<std::uint8_t>(*requete_.priorite_);
+                    break;
+                case Critere::Echeance:
+                    ok = c.dates[ligne] >= requete_.echeance_->first &&
+                         c.dates[ligne] <= requete_.echeance_->second;
+                    break;
+                case Critere::MotCle:
+                    ok = table_->description(ligne).find(*requete_.motCle_) != std::string_view::npos;
+                    break;
+            }
+            if (!ok) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const TableTaches* table_;
+    RequeteTaches requete_;
+    PlanRequete plan_;
+    std::optional<simd::Selection> candidates_;
+};
@@ -0,0 +1,459 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Socket Unix, epoll et eventfd : ce serveur n'existe que sous Linux.
+#if !defined(__linux__)
+#error "serveur_taches.hpp n'est disponible que sous Linux"
+#endif
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "taches.hpp"
+
+// --- Protocole du serveur de tâches (socket Unix, Linux) ---
+// Chaque message est une trame : longueur u32 | contenu. Une requête
+// commence par son type (u8) :
+//   Ajout       priorité u8 | longueur de la date u8 | date | description
+//   Statut      id i32 | statut u8
+//   Suppression id i32
+//   Recherche   mot-clé
+//   Filtre      statut u8
+//   Liste       ordre u8 | limite u32 (0xFFFFFFFF : toutes)
+//   Sauvegarde
+// Une réponse commence par son code (u8, 0 = ok), suivi pour un ajout de
+// l'id (i32), et pour une recherche, un filtre ou une liste du nombre de
+// tâches (u32) puis de chaque tâche :
+//   id i32 | statut u8 | priorité u8 | date u32 | longueur u32 | description
+// Aucune trame ne dépasse tailleMaxTrame, dans un sens comme dans l'autre :
+// une réponse plus longue est découpée en pages de cette même forme, toutes
+// avec le code Suite sauf la dernière.
+// Les entiers sont dans l'ordre de la machine, comme dans l'instantané.
+// Un client peut envoyer plusieurs requêtes sans attendre (pipelining) :
+// les réponses arrivent dans l'ordre des requêtes.
+namespace protocole {
+enum class Requete : std::uint8_t {
+    Ajout = 1,
+    Statut,
+    Suppression,
+    Recherche,
+    Filtre,
+    Liste,
+    Sauvegarde
+};
+enum class Code : std::uint8_t { Ok = 0, Erreur = 1, Suite = 2 };
+
+inline constexpr std::size_t tailleEnTete = 4;
+// Au-delà, la trame est jugée corrompue et la connexion fermée.
+inline constexpr std::size_t tailleMaxTrame = 1 << 20;
+inline constexpr std::uint32_t toutes = 0xFFFFFFFF;
+
+template <typename T>
+void ajouter(std::string& tampon, T valeur) {
+    char octets[sizeof(T)];
+    std::memcpy(octets, &valeur, sizeof(T));
+    tampon.append(octets, sizeof(T));
+}
+
+// Réserve la place de la longueur ; fermerTrame la remplit une fois le
+// contenu écrit à la suite.
+inline std::size_t ouvrirTrame(std::string& tampon) {
+    const std::size_t debut = tampon.size();
+    tampon.append(tailleEnTete, '\0');
+    return debut;
+}
+// Faux, et la trame est retirée du tampon, si son contenu dépasse
+// tailleMaxTrame : l'autre côté la refuserait.
+inline bool fermerTrame(std::string& tampon, std::size_t debut) {
+    const std::size_t longueur = tampon.size() - debut - tailleEnTete;
+    if (longueur > tailleMaxTrame) {
+        tampon.resize(debut);
+        return false;
+    }
+    const auto longueur32 = static_cast<std::uint32_t>(longueur);
+    std::memcpy(tampon.data() + debut, &longueur32, sizeof(longueur32));
+    return true;
+}
+
+// Longueur du contenu de la trame qui commence `donnees`, si l'en-tête est
+// arrivé.
+inline std::optional<std::size_t> longueurTrame(std::string_view donnees) {
+    if (donnees.size() < tailleEnTete) {
+        return std::nullopt;
+    }
+    return instantane::lire<std::uint32_t>(donnees.data());
+}
+
+inline constexpr std::size_t tailleFixeTache = 14;
+
+inline void ajouterTache(std::string& tampon, const Tache& tache) {
+    ajouter<std::int32_t>(tampon, tache.id);
+    ajouter(tampon, static_cast<std::uint8_t>(tache.statut));
+    ajouter(tampon, static_cast<std::uint8_t>(tache.priorite));
+    ajouter<std::uint32_t>(tampon, tache.dateEcheance);
+    ajouter(tampon, static_cast<std::uint32_t>(tache.description.size()));
+    tampon += tache.description;
+}
+} // namespace protocole
+
+// Garde les tâches en mémoire et répond aux requêtes de clients locaux sur
+// une socket Unix. Un seul thread : une boucle epoll surveille la socket
+// d'écoute et toutes les connexions, sans bloquer sur aucune. Chaque
+// lecture traite d'un coup les trames complètes reçues, et les
+// réponses s'accumulent dans le tampon de sortie de la connexion, envoyé
+// quand la socket l'accepte. Le gestionnaire n'est touché que par ce
+// thread : pas de verrou.
+//
+// Un client qui envoie des requêtes sans lire les réponses ferait grossir
+// ce tampon sans limite : au-delà de seuilSortie octets en attente, ses
+// trames ne sont plus traitées et sa socket n'est plus lue (EPOLLIN
+// retiré) jusqu'à ce qu'il ait récupéré ses réponses.
+class ServeurTaches {
+public:
+    static constexpr std::size_t seuilSortie = 4 * protocole::tailleMaxTrame;
+
+    explicit ServeurTaches(GestionnaireTaches& gestionnaire) : gestionnaire_(gestionnaire) {}
+    ServeurTaches(const ServeurTaches&) = delete;
+    ServeurTaches& operator=(const ServeurTaches&) = delete;
+    ~ServeurTaches() {
+        for (const auto& [descripteur, connexion] : connexions_) {
+            ::close(descripteur);
+        }
+        for (const int descripteur : {ecoute_, reveil_, epoll_}) {
+            if (descripteur >= 0) {
+                ::close(descripteur);
+            }
+        }
+        if (!chemin_.empty()) {
+            std::filesystem::remove(chemin_);
+        }
+    }
+
+    // Crée la socket (en remplaçant un fichier laissé par un serveur
+    // arrêté) ; faux en cas d'échec.
+    bool ecouter(const std::filesystem::path& chemin) {
+        sockaddr_un adresse{};
+        adresse.sun_family = AF_UNIX;
+        const std::string texte = chemin.string();
+        if (texte.size() >= sizeof(adresse.sun_path)) {
+            return false;
+        }
+        std::memcpy(adresse.sun_path, texte.c_str(), texte.size() + 1);
+        std::error_code erreur;
+        std::filesystem::remove(chemin, erreur);
+
+        ecoute_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        epoll_ = ::epoll_create1(EPOLL_CLOEXEC);
+        reveil_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (ecoute_ < 0 || epoll_ < 0 || reveil_ < 0 ||
+            ::bind(ecoute_, reinterpret_cast<const sockaddr*>(&adresse), sizeof(adresse)) != 0) {
+            return false;
+        }
+        chemin_ = chemin;
+        return ::listen(ecoute_, SOMAXCONN) == 0 && surveiller(ecoute_, EPOLLIN) &&
+               surveiller(reveil_, EPOLLIN);
+    }
+
+    // Boucle jusqu'à arreter().
+    void servir() {
+        std::array<epoll_event, 256> evenements;
+        bool actif = true;
+        while (actif) {
+            const int n =
+                ::epoll_wait(epoll_, evenements.data(), static_cast<int>(evenements.size()), -1);
+            for (int i = 0; i < n; ++i) {
+                const int descripteur = evenements[i].data.fd;
+                if (descripteur == reveil_) {
+                    actif = false;
+                } else if (descripteur == ecoute_) {
+                    accepter();
+                } else {
+                    servirConnexion(descripteur, evenements[i].events);
+                }
+            }
+        }
+        gestionnaire_.synchroniser();
+    }
+
+    // Peut être appelé d'un autre thread ou d'un gestionnaire de signal.
+    void arreter() {
+        const std::uint64_t un = 1;
+        [[maybe_unused]] const auto ecrits = ::write(reveil_, &un, sizeof(un));
+    }
+
+    std::size_t nbConnexions() const {
+        return connexions_.size();
+    }
+
+private:
+    struct Connexion {
+        std::string entree;
+        std::string sortie;
+        std::size_t envoyes = 0;    // octets de `sortie` déjà partis
+        std::uint32_t evenements = EPOLLIN;
+
+        std::size_t enAttente() const {
+            return sortie.size() - envoyes;
+        }
+    };
+
+    bool surveiller(int descripteur, std::uint32_t evenements) {
+        epoll_event evenement{};
+        evenement.events = evenements;
+        evenement.data.fd = descripteur;
+        return ::epoll_ctl(epoll_, EPOLL_CTL_ADD, descripteur, &evenement) == 0;
+    }
+
+    void accepter() {
+        while (true) {
+            const int descripteur =
+                ::accept4(ecoute_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (descripteur < 0) {
+                return;
+            }
+            if (!surveiller(descripteur, EPOLLIN)) {
+                ::close(descripteur);
+                continue;
+            }
+            connexions_.emplace(descripteur, Connexion{});
+        }
+    }
+
+    void servirConnexion(int descripteur, std::uint32_t evenements) {
+        // Connexion fermée plus tôt dans le même tour de boucle.
+        const auto it = connexions_.find(descripteur);
+        if (it == connexions_.end()) {
+            return;
+        }
+        auto& connexion = it->second;
+        bool ouverte = true;
+        if ((evenements & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0) {
+            ouverte = lire(descripteur, connexion);
+        }
+        // Des trames laissées de côté par le seuil de sortie passent dès que
+        // la socket a tout accepté : aucun événement ne les réveillerait.
+        bool valide = true;
+        do {
+            valide = traiterTrames(connexion) && ecrire(descripteur, connexion);
+        } while (valide && connexion.enAttente() == 0 && trameComplete(connexion.entree));
+        // Un client qui a fermé reçoit quand même ce qui peut partir.
+        if (!valide || !ouverte) {
+            fermer(descripteur);
+        }
+    }
+
+    static bool trameComplete(std::string_view donnees) {
+        const auto longueur = protocole::longueurTrame(donnees);
+        return longueur && donnees.size() >= protocole::tailleEnTete + *longueur;
+    }
+
+    // Lit tout ce qui est arrivé ; faux si le client a fermé.
+    bool lire(int descripteur, Connexion& connexion) {
+        constexpr std::size_t tailleLecture = 64 * 1024;
+        bool ouverte = true;
+        while (true) {
+            const std::size_t avant = connexion.entree.size();
+            connexion.entree.resize(avant + tailleLecture);
+            const auto lus = ::read(descripteur, connexion.entree.data() + avant, tailleLecture);
+            connexion.entree.resize(avant + static_cast<std::size_t>(std::max<ssize_t>(lus, 0)));
+            if (lus == 0 || (lus < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+                ouverte = false;
+                break;
+            }
+            if (lus < 0) {
+                break;
+            }
+        }
+        return ouverte;
+    }
+
+    // Traite les trames complètes reçues, tant que les réponses en attente
+    // restent sous seuilSortie ; faux si une trame est invalide.
+    bool traiterTrames(Connexion& connexion) {
+        std::string_view restant(connexion.entree);
+        while (connexion.enAttente() < seuilSortie) {
+            const auto longueur = protocole::longueurTrame(restant);
+            if (!longueur) {
+                break;
+            }
+            if (*longueur > protocole::tailleMaxTrame || *longueur == 0) {
+                return false;
+            }
+            if (restant.size() < protocole::tailleEnTete + *longueur) {
+                break;
+            }
+            traiter(restant.substr(protocole::tailleEnTete, *longueur), connexion.sortie);
+            restant.remove_prefix(protocole::tailleEnTete + *longueur);
+        }
+        connexion.entree.erase(0, connexion.entree.size() - restant.size());
+        return true;
+    }
+
+    // Envoie ce que la socket accepte ; le reste attend EPOLLOUT, et la
+    // lecture s'arrête tant qu'il dépasse seuilSortie.
+    bool ecrire(int descripteur, Connexion& connexion) {
+        while (connexion.envoyes < connexion.sortie.size()) {
+            const auto ecrits = ::send(descripteur, connexion.sortie.data() + connexion.envoyes,
+                                       connexion.sortie.size() - connexion.envoyes, MSG_NOSIGNAL);
+            if (ecrits < 0) {
+                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                    return false;
+                }
+                break;
+            }
+            connexion.envoyes += static_cast<std::size_t>(ecrits);
+        }
+        if (connexion.envoyes == connexion.sortie.size()) {
+            connexion.sortie.clear();
+            connexion.envoyes = 0;
+        }
+        const std::uint32_t voulus = (connexion.enAttente() < seuilSortie ? EPOLLIN : 0u) |
+                                     (connexion.enAttente() > 0 ? EPOLLOUT : 0u);
+        if (voulus != connexion.evenements) {
+            epoll_event evenement{};
+            evenement.events = voulus;
+            evenement.data.fd = descripteur;
+            ::epoll_ctl(epoll_, EPOLL_CTL_MOD, descripteur, &evenement);
+            connexion.evenements = voulus;
+        }
+        return true;
+    }
+
+    void fermer(int descripteur) {
+        ::epoll_ctl(epoll_, EPOLL_CTL_DEL, descripteur, nullptr);
+        ::close(descripteur);
+        connexions_.erase(descripteur);
+    }
+
+    // Ajoute à `sortie` la réponse à une requête.
+    void traiter(std::string_view requete, std::string& sortie) {
+        using protocole::Code;
+        using protocole::Requete;
+        std::size_t trame = protocole::ouvrirTrame(sortie);
+        const auto type = static_cast<Requete>(requete[0]);
+        const std::string_view donnees = requete.substr(1);
+        auto code = [&sortie](Code c) { protocole::ajouter(sortie, static_cast<std::uint8_t>(c)); };
+        auto octet = [&donnees](std::size_t position) {
+            return static_cast<std::uint8_t>(donnees[position]);
+        };
+
+        bool ok = false;
+        if (type == Requete::Ajout && donnees.size() >= 2 && octet(0) >= 1 && octet(0) <= 3 &&
+            donnees.size() >= 2u + octet(1)) {
+            const auto id = gestionnaire_.ajouterTache(donnees.substr(2 + octet(1)),
+                                                       static_cast<Priorite>(octet(0)),
+                                                       donnees.substr(2, octet(1)));
+            if (id) {
+                code(Code::Ok);
+                protocole::ajouter<std::int32_t>(sortie, *id);
+                ok = true;
+            }
+        } else if (type == Requete::Statut && donnees.size() == 5 && octet(4) <= 2) {
+            ok = gestionnaire_.changerStatut(instantane::lire<std::int32_t>(donnees.data()),
+                                             static_cast<Statut>(octet(4)));
+            if (ok) {
+                code(Code::Ok);
+            }
+        } else if (type == Requete::Suppression && donnees.size() == 4) {
+            ok = gestionnaire_.supprimerTache(instantane::lire<std::int32_t>(donnees.data()));
+            if (ok) {
+                code(Code::Ok);
+            }
+        } else if (type == Requete::Recherche) {
+            ok = ecrireLignes(sortie, trame, gestionnaire_.rechercherMotCle(donnees));
+        } else if (type == Requete::Filtre && donnees.size() == 1 && octet(0) <= 2) {
+            ok = ecrireLignes(sortie, trame,
+                              gestionnaire_.filtrerParStatut(static_cast<Statut>(octet(0))));
+        } else if (type == Requete::Liste && donnees.size() == 5 && octet(0) <= 2) {
+            const auto limite = instantane::lire<std::uint32_t>(donnees.data() + 1);
+            const std::size_t nombre =
+                limite == protocole::toutes ? gestionnaire_.taille()
+                                            : std::min<std::size_t>(limite, gestionnaire_.taille());
+            ok = ecrirePages(sortie, trame, [&](auto&& ajouter) {
+                gestionnaire_.pourLesPremieres(static_cast<Ordre>(octet(0)), nombre, ajouter);
+            });
+        } else if (type == Requete::Sauvegarde) {
+            ok = gestionnaire_.synchroniser();
+            if (ok) {
+                code(Code::Ok);
+            }
+        }
+        if (!ok) {
+            code(Code::Erreur);
+        }
+        protocole::fermerTrame(sortie, trame);
+    }
+
+    bool ecrireLignes(std::string& sortie, std::size_t& trame, const simd::Selection& lignes) {
+        return ecrirePages(sortie, trame, [&](auto&& ajouter) {
+            for (const auto ligne : lignes) {
+                ajouter(gestionnaire_.table().ligne(ligne));
+            }
+        });
+    }
+
+    // Écrit les tâches que `parcourir` passe à sa fonction, en pages qui
+    // tiennent chacune dans une trame : la trame `trame`, déjà ouverte, est
+    // fermée avec le code Suite dès que la tâche suivante n'y tient plus, et
+    // une nouvelle page s'ouvre. La dernière reste ouverte, avec le code Ok.
+    // Faux, la dernière page vidée, si une tâche ne tient pas seule dans une
+    // page.
+    template <typename Parcours>
+    bool ecrirePages(std::string& sortie, std::size_t& trame, Parcours&& parcourir) {
+        using protocole::Code;
+        constexpr std::size_t tailleEnTetePage = 1 + sizeof(std::uint32_t);
+        std::uint32_t nombre = 0;
+        auto completerPage = [&](Code code) {
+            sortie[trame + protocole::tailleEnTete] = static_cast<char>(code);
+            std::memcpy(sortie.data() + trame + protocole::tailleEnTete + 1, &nombre,
+                        sizeof(nombre));
+        };
+        sortie.append(tailleEnTetePage, '\0');
+        bool ok = true;
+        parcourir([&](const Tache& tache) {
+            const std::size_t taille = protocole::tailleFixeTache + tache.description.size();
+            if (!ok || tailleEnTetePage + taille > protocole::tailleMaxTrame) {
+                ok = false;
+                return;
+            }
+            if (sortie.size() - trame - protocole::tailleEnTete + taille >
+                protocole::tailleMaxTrame) {
+                completerPage(Code::Suite);
+                protocole::fermerTrame(sortie, trame);
+                trame = protocole::ouvrirTrame(sortie);
+                sortie.append(tailleEnTetePage, '\0');
+                nombre = 0;
+            }
+            protocole::ajouterTache(sortie, tache);
+            ++nombre;
+        });
+        if (!ok) {
+            sortie.resize(trame + protocole::tailleEnTete);
+            return false;
+        }
+        completerPage(Code::Ok);
+        return true;
+    }
+
+    GestionnaireTaches& gestionnaire_;
+    std::filesystem::path chemin_;
+    int ecoute_ = -1;
+    int epoll_ = -1;
+    int reveil_ = -1;
+    std::unordered_map<int, Connexion> connexions_;
+};
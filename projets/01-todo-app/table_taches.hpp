@@ -0,0 +1,380 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "arena_textes.hpp"
+#include "noyaux_simd.hpp"
+#include "parallele.hpp"
+
+enum class Statut : std::uint8_t {
+    AFaire,
+    EnCours,
+    Terminee
+};
+enum class Priorite : std::uint8_t {
+    Basse = 1,
+    Moyenne = 2,
+    Haute = 3
+};
+
+// Date d'échéance : numéro de jour sur 32 bits, std::chrono::sys_days
+// décalé pour que le 0000-01-01 vaille 1. 0 signifie « pas d'échéance ».
+// Comparer deux dates revient à comparer deux entiers, et l'absence
+// d'échéance passe avant toutes les dates (comme la chaîne vide passait
+// avant toutes les dates ISO).
+using DateCompacte = std::uint32_t;
+inline constexpr DateCompacte sansEcheance = 0;
+
+namespace date_compacte {
+inline constexpr std::int64_t decalage =
+    1 - std::chrono::sys_days{std::chrono::year{0} / 1 / 1}.time_since_epoch().count();
+inline constexpr DateCompacte maximum = static_cast<DateCompacte>(
+    std::chrono::sys_days{std::chrono::year{9999} / 12 / 31}.time_since_epoch().count() + decalage);
+} // namespace date_compacte
+
+inline DateCompacte dateDepuisJours(std::chrono::sys_days jour) {
+    return static_cast<DateCompacte>(jour.time_since_epoch().count() + date_compacte::decalage);
+}
+
+inline std::chrono::year_month_day jourDepuisDate(DateCompacte date) {
+    return std::chrono::sys_days{std::chrono::days{static_cast<std::int64_t>(date) - date_compacte::decalage}};
+}
+
+inline DateCompacte aujourdhui() {
+    return dateDepuisJours(std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now()));
+}
+
+// Accepte "" (pas d'échéance) ou une date ISO "YYYY-MM-DD" qui existe au
+// calendrier (pas de 31 avril ni de 29 février hors année bissextile).
+inline std::optional<DateCompacte> dateDepuisTexte(std::string_view texte) {
+    if (texte.empty()) {
+        return sansEcheance;
+    }
+    if (texte.size() != 10 || texte[4] != '-' || texte[7] != '-') {
+        return std::nullopt;
+    }
+    auto nombre = [texte](std::size_t debut, std::size_t longueur) {
+        unsigned valeur = 0;
+        for (std::size_t i = debut; i < debut + longueur; ++i) {
+            if (texte[i] < '0' || texte[i] > '9') {
+                return ~0u;
+            }
+            valeur = valeur * 10 + static_cast<unsigned>(texte[i] - '0');
+        }
+        return valeur;
+    };
+    const unsigned annee = nombre(0, 4);
+    const unsigned mois = nombre(5, 2);
+    const unsigned jour = nombre(8, 2);
+    if (annee > 9999 || mois > 12 || jour > 31) {
+        return std::nullopt;
+    }
+    const std::chrono::year_month_day date{std::chrono::year{static_cast<int>(annee)},
+                                           std::chrono::month{mois}, std::chrono::day{jour}};
+    if (!date.ok()) {
+        return std::nullopt;
+    }
+    return dateDepuisJours(std::chrono::sys_days{date});
+}
+
+inline bool dateValide(DateCompacte date) {
+    return date <= date_compacte::maximum;
+}
+
+// Écrit "YYYY-MM-DD" (10 caractères) à partir de `sortie` et renvoie la
+// fin ; rien pour sansEcheance. Sans allocation.
+inline char* ecrireDate(char* sortie, DateCompacte date) {
+    if (date == sansEcheance) {
+        return sortie;
+    }
+    const auto jour = jourDepuisDate(date);
+    const auto annee = static_cast<unsigned>(static_cast<int>(jour.year()));
+    auto deuxChiffres = [](char* p, unsigned valeur) {
+        p[0] = static_cast<char>('0' + valeur / 10);
+        p[1] = static_cast<char>('0' + valeur % 10);
+    };
+    deuxChiffres(sortie, annee / 100);
+    deuxChiffres(sortie + 2, annee % 100);
+    sortie[4] = '-';
+    deuxChiffres(sortie + 5, static_cast<unsigned>(jour.month()));
+    sortie[7] = '-';
+    deuxChiffres(sortie + 8, static_cast<unsigned>(jour.day()));
+    return sortie + 10;
+}
+
+inline std::string dateVersTexte(DateCompacte date) {
+    char texte[10];
+    return std::string(texte, ecrireDate(texte, date));
+}
+
+// Vue sur une ligne de TableTaches. La description pointe dans le tas de la
+// table : elle reste valide jusqu'à la prochaine modification de la table.
+struct Tache {
+    int id;
+    std::string_view description;
+    Statut statut;
+    Priorite priorite;
+    DateCompacte dateEcheance;
+};
+
+// Les colonnes brutes d'une table : un tableau contigu par champ, et une
+// arène où les descriptions sont rangées bout à bout.
+struct ColonnesTaches {
+    std::vector<std::int32_t> ids;
+    std::vector<std::uint8_t> statuts;
+    std::vector<std::uint8_t> priorites;
+    std::vector<DateCompacte> dates;
+    std::vector<ArenaTextes::Poignee> descriptions;
+    std::vector<std::uint32_t> longueursDescription;
+    ArenaTextes textes;
+};
+
+// Stockage des tâches en colonnes (structure of arrays). Filtrer ou compter
+// par statut ne lit qu'un octet par tâche, au lieu de faire passer dans le
+// cache un enregistrement complet avec deux std::string.
+// Une ligne supprimée garde sa place avec le statut ligneLibre (et une
+// priorité nulle) : aucun parcours de colonne ne la compte.
+// Avec l'internement, des descriptions identiques partagent le même texte
+// dans l'arène.
+class TableTaches {
+public:
+    static constexpr std::uint8_t ligneLibre = 0xFF;
+
+    TableTaches() = default;
+    explicit TableTaches(ColonnesTaches colonnes) : c_(std::move(colonnes)) {}
+
+    std::size_t nbLignes() const {
+        return c_.ids.size();
+    }
+    bool estLibre(std::size_t ligne) const {
+        return c_.statuts[ligne] == ligneLibre;
+    }
+    std::string_view description(std::size_t ligne) const {
+        return c_.textes.texte(c_.descriptions[ligne], c_.longueursDescription[ligne]);
+    }
+    Tache ligne(std::size_t i) const {
+        return {c_.ids[i], description(i), static_cast<Statut>(c_.statuts[i]),
+                static_cast<Priorite>(c_.priorites[i]), c_.dates[i]};
+    }
+    const ColonnesTaches& colonnes() const {
+        return c_;
+    }
+
+    simd::Selection selectionnerStatut(Statut statut) const {
+        return simd::selectionnerEgal(c_.statuts.data(), nbLignes(), static_cast<std::uint8_t>(statut));
+    }
+    // Indexés par Statut (AFaire, EnCours, Terminee).
+    std::array<std::size_t, 3> compterParStatut() const {
+        return simd::compterValeurs<3>(c_.statuts.data(), nbLignes(), 0);
+    }
+    // Indexés par Priorite - 1 (Basse, Moyenne, Haute).
+    std::array<std::size_t, 3> compterParPriorite() const {
+        return simd::compterValeurs<3>(c_.priorites.data(), nbLignes(), 1);
+    }
+
+    void reserver(std::size_t lignes, std::size_t octetsTas,
+                  std::size_t tailleMinBloc = ArenaTextes::tailleBloc) {
+        c_.ids.reserve(lignes);
+        c_.statuts.reserve(lignes);
+        c_.priorites.reserve(lignes);
+        c_.dates.reserve(lignes);
+        c_.descriptions.reserve(lignes);
+        c_.longueursDescription.reserve(lignes);
+        c_.textes.reserver(octetsTas, tailleMinBloc);
+    }
+    // Place pour `lignes` de plus, sans perdre la croissance géométrique :
+    // des réservations exactes répétées recopieraient les colonnes à chaque
+    // fois.
+    void reserverEnPlus(std::size_t lignes, std::size_t octetsTas) {
+        const std::size_t voulu = nbLignes() + lignes;
+        reserver(voulu > c_.ids.capacity() ? std::max(voulu, 2 * c_.ids.capacity()) : 0, octetsTas);
+    }
+
+    // `ecrireDescription(bloc)` ajoute au plus `tailleMax` octets à la fin
+    // d'un bloc de l'arène : le chargeur CSV y décode directement le champ,
+    // sans chaîne intermédiaire.
+    template <typename Ecrivain>
+    void ajouter(int id, Statut statut, Priorite priorite, DateCompacte date,
+                 std::size_t tailleMax, Ecrivain&& ecrireDescription) {
+        std::uint32_t longueur = 0;
+        auto poignee = c_.textes.ecrire(tailleMax, ecrireDescription, longueur);
+        if (interne_) {
+            poignee = interner(poignee, longueur);
+        }
+        c_.ids.push_back(id);
+        c_.statuts.push_back(static_cast<std::uint8_t>(statut));
+        c_.priorites.push_back(static_cast<std::uint8_t>(priorite));
+        c_.dates.push_back(date);
+        c_.descriptions.push_back(poignee);
+        c_.longueursDescription.push_back(longueur);
+    }
+    void ajouter(int id, std::string_view description, Statut statut, Priorite priorite,
+                 DateCompacte date) {
+        ajouter(id, statut, priorite, date, description.size(),
+                [description](std::string& bloc) { bloc.append(description); });
+    }
+
+    // Les descriptions ajoutées ensuite sont partagées avec une description
+    // identique déjà présente. Pour en faire profiter les lignes existantes,
+    // appeler internerDescriptions().
+    void activerInternement(bool actif = true) {
+        interne_ = actif;
+        internes_.clear();
+    }
+    // Recopie chaque texte distinct une seule fois dans une nouvelle arène ;
+    // les lignes ne bougent pas.
+    void internerDescriptions() {
+        const ArenaTextes anciens = std::move(c_.textes);
+        c_.textes = {};
+        internes_.clear();
+        for (std::size_t i = 0; i < nbLignes(); ++i) {
+            const auto longueur = c_.longueursDescription[i];
+            c_.descriptions[i] =
+                interner(c_.textes.ajouter(anciens.texte(c_.descriptions[i], longueur)), longueur);
+        }
+    }
+    bool internementActif() const {
+        return interne_;
+    }
+
+    void changerStatut(std::size_t ligne, Statut statut) {
+        c_.statuts[ligne] = static_cast<std::uint8_t>(statut);
+    }
+    void liberer(std::size_t ligne) {
+        c_.statuts[ligne] = ligneLibre;
+        c_.priorites[ligne] = 0;
+    }
+    void vider() {
+        c_ = {};
+    }
+
+    // Reconstruit la table avec les lignes ordre[0], ordre[1]... : sert à
+    // compacter (lignes occupées dans l'ordre) comme à trier. Le tas est
+    // réécrit dans le nouvel ordre, sans les descriptions des lignes libérées.
+    void reordonner(const std::vector<std::size_t>& ordre) {
+        std::size_t octets = 0;
+        for (const std::size_t i : ordre) {
+            octets += c_.longueursDescription[i];
+        }
+        TableTaches resultat;
+        resultat.interne_ = interne_;
+        resultat.reserver(ordre.size(), interne_ ? 0 : octets);
+        for (const std::size_t i : ordre) {
+            resultat.ajouter(c_.ids[i], description(i), static_cast<Statut>(c_.statuts[i]),
+                             static_cast<Priorite>(c_.priorites[i]), c_.dates[i]);
+        }
+        *this = std::move(resultat);
+    }
+
+    // Copie des seules lignes occupées, dans le même ordre et sans place
+    // perdue : les descriptions tiennent dans un bloc à leur taille exacte.
+    // `lignesEnPlus` et `octetsEnPlus` réservent la place d'ajouts à venir.
+    TableTaches copieCompacte(std::size_t lignesEnPlus = 0, std::size_t octetsEnPlus = 0) const {
+        std::size_t lignes = 0;
+        std::size_t octets = 0;
+        for (std::size_t i = 0; i < nbLignes(); ++i) {
+            if (!estLibre(i)) {
+                ++lignes;
+                octets += c_.longueursDescription[i];
+            }
+        }
+        // Sans ligne libre ni place à réserver, la copie telle quelle suffit :
+        // chaque bloc de l'arène est recopié à sa taille exacte.
+        if (lignes == nbLignes() && lignesEnPlus == 0 && octetsEnPlus == 0) {
+            return *this;
+        }
+        TableTaches copie;
+        copie.reserver(lignes + lignesEnPlus, octets + octetsEnPlus, 0);
+        for (std::size_t i = 0; i < nbLignes(); ++i) {
+            if (!estLibre(i)) {
+                copie.ajouter(c_.ids[i], description(i), static_cast<Statut>(c_.statuts[i]),
+                              static_cast<Priorite>(c_.priorites[i]), c_.dates[i]);
+            }
+        }
+        return copie;
+    }
+
+    void compacter() {
+        std::vector<std::size_t> occupees;
+        occupees.reserve(nbLignes());
+        for (std::size_t i = 0; i < nbLignes(); ++i) {
+            if (!estLibre(i)) {
+                occupees.push_back(i);
+            }
+        }
+        reordonner(occupees);
+    }
+
+    // Met bout à bout les tables d'un chargement par morceaux. L'arène
+    // reprend les blocs de chaque morceau sans recopier les descriptions ;
+    // les colonnes sont recopiées à leur place définitive en parallèle.
+    static TableTaches concatener(std::vector<TableTaches>& morceaux, unsigned nbThreads) {
+        std::vector<std::size_t> premieresLignes(morceaux.size() + 1, 0);
+        for (std::size_t m = 0; m < morceaux.size(); ++m) {
+            premieresLignes[m + 1] = premieresLignes[m] + morceaux[m].nbLignes();
+        }
+
+        ColonnesTaches total;
+        std::vector<ArenaTextes::Poignee> decalages(morceaux.size());
+        for (std::size_t m = 0; m < morceaux.size(); ++m) {
+            decalages[m] = total.textes.adopter(std::move(morceaux[m].c_.textes));
+        }
+        const std::size_t n = premieresLignes.back();
+        total.ids.resize(n);
+        total.statuts.resize(n);
+        total.priorites.resize(n);
+        total.dates.resize(n);
+        total.descriptions.resize(n);
+        total.longueursDescription.resize(n);
+
+        executerEnParallele(morceaux.size(), nbThreads, [&](std::size_t m) {
+            ColonnesTaches& source = morceaux[m].c_;
+            const std::size_t premiere = premieresLignes[m];
+            std::copy(source.ids.begin(), source.ids.end(), total.ids.begin() + premiere);
+            std::copy(source.statuts.begin(), source.statuts.end(), total.statuts.begin() + premiere);
+            std::copy(source.priorites.begin(), source.priorites.end(),
+                      total.priorites.begin() + premiere);
+            std::copy(source.dates.begin(), source.dates.end(), total.dates.begin() + premiere);
+            std::copy(source.longueursDescription.begin(), source.longueursDescription.end(),
+                      total.longueursDescription.begin() + premiere);
+            std::transform(source.descriptions.begin(), source.descriptions.end(),
+                           total.descriptions.begin() + premiere,
+                           [decalage = decalages[m]](ArenaTextes::Poignee p) { return p + decalage; });
+            source = {};
+        });
+        return TableTaches(std::move(total));
+    }
+
+private:
+    struct TexteInterne {
+        ArenaTextes::Poignee poignee;
+        std::uint32_t longueur;
+    };
+
+    // Une collision de hachage entre deux textes différents n'est pas
+    // résolue : le second garde simplement son propre exemplaire.
+    ArenaTextes::Poignee interner(ArenaTextes::Poignee poignee, std::uint32_t longueur) {
+        const auto texte = c_.textes.texte(poignee, longueur);
+        const auto [it, nouveau] =
+            internes_.try_emplace(std::hash<std::string_view>{}(texte), TexteInterne{poignee, longueur});
+        if (!nouveau && it->second.longueur == longueur &&
+            c_.textes.texte(it->second.poignee, longueur) == texte) {
+            c_.textes.annulerDernier(poignee);
+            return it->second.poignee;
+        }
+        return poignee;
+    }
+
+    ColonnesTaches c_;
+    bool interne_ = false;
+    std::unordered_map<std::size_t, TexteInterne> internes_;
+};
@@ -0,0 +1,1459 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "fichier_projete.hpp"
+#include "index_trigrammes.hpp"
+#include "journal.hpp"
+#include "parallele.hpp"
+#include "rendu_taches.hpp"
+#include "requete_taches.hpp"
+#include "table_taches.hpp"
+#include "vues_triees.hpp"
+
+inline std::optional<Statut> statutDepuisTexte(std::string_view texte) {
+    if (texte == "A_FAIRE") {
+        return Statut::AFaire;
+    }
+    if (texte == "EN_COURS") {
+        return Statut::EnCours;
+    }
+    if (texte == "TERMINEE") {
+        return Statut::Terminee;
+    }
+    return std::nullopt;
+}
+inline std::optional<Priorite> prioriteDepuisTexte(std::string_view texte) {
+    if (texte == "BASSE") {
+        return Priorite::Basse;
+    }
+    if (texte == "MOYENNE") {
+        return Priorite::Moyenne;
+    }
+    if (texte == "HAUTE") {
+        return Priorite::Haute;
+    }
+    return std::nullopt;
+}
+
+// --- Lecture d'une ligne CSV sans flux intermédiaire ---
+// Format : id;"description";STATUT;PRIORITE;date
+// La description est écrite avec std::quoted : elle peut contenir des ';'
+// et des guillemets échappés par '\\'.
+
+inline bool estEspace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+// Même règle que std::stoi : espaces initiaux, signe optionnel, chiffres,
+// et les caractères qui suivent sont ignorés.
+inline std::optional<int> entierDepuisTexte(std::string_view texte) {
+    std::size_t i = 0;
+    while (i < texte.size() && estEspace(texte[i])) {
+        ++i;
+    }
+    if (i < texte.size() && texte[i] == '+') {
+        ++i;
+        if (i < texte.size() && texte[i] == '-') {
+            return std::nullopt;
+        }
+    }
+    int valeur = 0;
+    auto [fin, erreur] = std::from_chars(texte.data() + i, texte.data() + texte.size(), valeur);
+    if (erreur != std::errc{}) {
+        return std::nullopt;
+    }
+    return valeur;
+}
+
+// Position du guillemet fermant d'une chaîne ouverte juste avant `debut`
+// (un '\\' échappe le caractère suivant), ou npos. On saute de caractère
+// spécial en caractère spécial avec find (memchr) plutôt qu'octet par octet.
+inline std::size_t guillemetFermant(std::string_view texte, std::size_t debut) {
+    while (true) {
+        const auto guillemet = texte.find('"', debut);
+        const auto echappement = texte.substr(0, guillemet).find('\\', debut);
+        if (echappement == std::string_view::npos) {
+            return guillemet;
+        }
+        debut = echappement + 2;
+    }
+}
+
+// Position du ';' qui termine le champ description commençant en `debut`,
+// ou npos si la ligne est incomplète.
+inline std::size_t finChampDescription(std::string_view ligne, std::size_t debut) {
+    std::size_t i = debut;
+    while (i < ligne.size() && estEspace(ligne[i])) {
+        ++i;
+    }
+    if (i < ligne.size() && ligne[i] == '"') {
+        i = guillemetFermant(ligne, i + 1);
+        if (i == std::string_view::npos) {
+            return i;
+        }
+    }
+    return ligne.find(';', i);
+}
+
+// Équivalent de `flux >> std::quoted(resultat)` appliqué au champ ; le
+// résultat est ajouté à la fin de `sortie`.
+inline void decoderDescription(std::string_view champ, std::string& sortie) {
+    std::size_t i = 0;
+    while (i < champ.size() && estEspace(champ[i])) {
+        ++i;
+    }
+    if (i == champ.size()) {
+        return;
+    }
+    if (champ[i] != '"') {
+        std::size_t fin = i;
+        while (fin < champ.size() && !estEspace(champ[fin])) {
+            ++fin;
+        }
+        sortie.append(champ.substr(i, fin - i));
+        return;
+    }
+
+    const auto fin = std::min(guillemetFermant(champ, i + 1), champ.size());
+    for (++i; i < fin;) {
+        const auto echappement = std::min(champ.substr(0, fin).find('\\', i), fin);
+        sortie.append(champ.substr(i, echappement - i));
+        if (echappement + 1 >= fin) {
+            break;
+        }
+        sortie += champ[echappement + 1];
+        i = echappement + 2;
+    }
+}
+
+// Ce qu'un chargement (CSV ou instantané) n'a pas pu reprendre tel quel.
+struct BilanChargement {
+    std::size_t lignesIgnorees = 0;    // incomplètes, id, statut ou priorité invalides
+    std::size_t datesIgnorees = 0;     // tâche gardée, sans échéance
+
+    BilanChargement& operator+=(const BilanChargement& autre) {
+        lignesIgnorees += autre.lignesIgnorees;
+        datesIgnorees += autre.datesIgnorees;
+        return *this;
+    }
+};
+
+// Ajoute la tâche décrite par `ligne` à la table. Une ligne incomplète, un
+// id, un statut ou une priorité invalides font ignorer la ligne. Une date
+// illisible (l'ancienne application acceptait n'importe quel texte) est
+// remplacée par « sans échéance ». Les deux cas sont comptés dans `bilan`.
+// Un '\r' final (fichier écrit sous Windows) est ignoré.
+inline bool analyserLigneCSV(std::string_view ligne, TableTaches& table, BilanChargement& bilan) {
+    if (ligne.ends_with('\r')) {
+        ligne.remove_suffix(1);
+    }
+    if (ligne.empty()) {
+        return false;
+    }
+    auto ignorer = [&bilan] {
+        ++bilan.lignesIgnorees;
+        return false;
+    };
+    const auto finId = ligne.find(';');
+    if (finId == std::string_view::npos) {
+        return ignorer();
+    }
+    const auto finDescription = finChampDescription(ligne, finId + 1);
+    if (finDescription == std::string_view::npos) {
+        return ignorer();
+    }
+    const auto finStatut = ligne.find(';', finDescription + 1);
+    if (finStatut == std::string_view::npos) {
+        return ignorer();
+    }
+    const auto finPriorite = ligne.find(';', finStatut + 1);
+    if (finPriorite == std::string_view::npos) {
+        return ignorer();
+    }
+
+    auto id = entierDepuisTexte(ligne.substr(0, finId));
+    auto statut = statutDepuisTexte(ligne.substr(finDescription + 1, finStatut - finDescription - 1));
+    auto priorite = prioriteDepuisTexte(ligne.substr(finStatut + 1, finPriorite - finStatut - 1));
+    if (!id || !statut || !priorite) {
+        return ignorer();
+    }
+    auto date = dateDepuisTexte(ligne.substr(finPriorite + 1));
+    if (!date) {
+        ++bilan.datesIgnorees;
+        date = sansEcheance;
+    }
+    const auto champ = ligne.substr(finId + 1, finDescription - finId - 1);
+    table.ajouter(*id, *statut, *priorite, *date, champ.size(),
+                  [champ](std::string& bloc) { decoderDescription(champ, bloc); });
+    return true;
+}
+
+// Découpe `contenu` en au plus `nbMorceaux` morceaux qui commencent tous en
+// début de ligne. Une ligne est un enregistrement complet (std::quoted
+// n'écrit jamais de '\n'), donc un ';' ou un guillemet échappé dans une
+// description ne peut pas chevaucher deux morceaux.
+inline std::vector<std::string_view> decouperEnMorceaux(std::string_view contenu,
+                                                        std::size_t nbMorceaux) {
+    std::vector<std::string_view> morceaux;
+    const std::size_t cible = contenu.size() / std::max<std::size_t>(1, nbMorceaux) + 1;
+    while (!contenu.empty()) {
+        auto fin = contenu.find('\n', std::min(cible, contenu.size()) - 1);
+        fin = fin == std::string_view::npos ? contenu.size() : fin + 1;
+        morceaux.push_back(contenu.substr(0, fin));
+        contenu.remove_prefix(fin);
+    }
+    return morceaux;
+}
+
+inline TableTaches analyserMorceauCSV(std::string_view morceau, BilanChargement& bilan) {
+    TableTaches table;
+    table.reserver(static_cast<std::size_t>(std::count(morceau.begin(), morceau.end(), '\n')) + 1,
+                   morceau.size());
+    while (!morceau.empty()) {
+        const auto finLigne = morceau.find('\n');
+        const auto ligne = morceau.substr(0, finLigne);
+        morceau.remove_prefix(finLigne == std::string_view::npos ? morceau.size() : finLigne + 1);
+        if (!ligne.empty()) {
+            analyserLigneCSV(ligne, table, bilan);
+        }
+    }
+    return table;
+}
+
+// Flux : std::getline ligne par ligne.
+// Projection : le fichier est projeté en mémoire (mmap) et découpé sur place,
+// par morceaux analysés en parallèle.
+// Les deux modes utilisent le même analyseur et donnent les mêmes tâches.
+enum class ModeChargement {
+    Flux,
+    Projection
+};
+
+// --- Instantané binaire ---
+// Un en-tête de 32 octets, des colonnes de largeur fixe, puis le tas des
+// descriptions :
+//   "TODOSNAP" | version u32 | génération u32 | nbTaches u64 | tailleTas u64
+//   debutDescription u64[n] | longueurDescription u32[n] | id i32[n]
+//   date u32[n] | statut u8[n] | priorite u8[n] | tas
+// Les colonnes sont rangées par largeur décroissante pour rester alignées.
+// La génération est celle du journal qui complète l'instantané.
+// Entiers dans l'ordre natif des octets, little-endian (x86, ARM).
+// Un instantané d'une autre version est refusé.
+namespace instantane {
+inline constexpr char magique[8] = {'T', 'O', 'D', 'O', 'S', 'N', 'A', 'P'};
+inline constexpr std::uint32_t version = 3;
+inline constexpr std::size_t tailleEnTete = 32;
+inline constexpr std::size_t octetsParTache = 8 + 4 + 4 + 4 + 1 + 1;
+
+template <typename T>
+void ecrire(char* destination, T valeur) {
+    std::memcpy(destination, &valeur, sizeof(T));
+}
+
+template <typename T>
+T lire(const char* source) {
+    T valeur;
+    std::memcpy(&valeur, source, sizeof(T));
+    return valeur;
+}
+
+template <typename T>
+std::vector<T> lireColonne(const char* source, std::size_t n) {
+    std::vector<T> colonne(n);
+    std::memcpy(colonne.data(), source, n * sizeof(T));
+    return colonne;
+}
+
+// Comme au chargement CSV, une date hors du calendrier ne fait pas perdre
+// la tâche : elle est gardée sans échéance, et comptée dans `datesIgnorees`.
+inline std::optional<ColonnesTaches> lireColonnes(std::string_view donnees, std::uint64_t n,
+                                                  std::uint64_t tailleTas,
+                                                  std::size_t& datesIgnorees) {
+    const std::size_t tailleColonnes = donnees.size() - tailleEnTete;
+    if (n > tailleColonnes / octetsParTache || tailleColonnes - n * octetsParTache != tailleTas) {
+        return std::nullopt;
+    }
+    const char* position = donnees.data() + tailleEnTete;
+    ColonnesTaches colonnes;
+    colonnes.descriptions = lireColonne<std::uint64_t>(position, n);
+    colonnes.longueursDescription = lireColonne<std::uint32_t>(position += 8 * n, n);
+    colonnes.ids = lireColonne<std::int32_t>(position += 4 * n, n);
+    colonnes.dates = lireColonne<DateCompacte>(position += 4 * n, n);
+    colonnes.statuts = lireColonne<std::uint8_t>(position += 4 * n, n);
+    colonnes.priorites = lireColonne<std::uint8_t>(position += n, n);
+    // Tout le tas tient dans un seul bloc de l'arène : une poignée est alors
+    // la position du texte dans le tas, décalée du numéro de ce bloc.
+    ArenaTextes::Poignee bloc = 0;
+    std::memcpy(colonnes.textes.nouveauBloc(tailleTas, bloc), position + n, tailleTas);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto debut = colonnes.descriptions[i];
+        colonnes.descriptions[i] += bloc;
+        if (debut > tailleTas || colonnes.longueursDescription[i] > tailleTas - debut ||
+            colonnes.statuts[i] > 2 || colonnes.priorites[i] < 1 || colonnes.priorites[i] > 3) {
+            return std::nullopt;
+        }
+        if (!dateValide(colonnes.dates[i])) {
+            colonnes.dates[i] = sansEcheance;
+            ++datesIgnorees;
+        }
+    }
+    return colonnes;
+}
+} // namespace instantane
+
+// Modifications préparées à part, puis appliquées d'un bloc par
+// GestionnaireTaches::appliquer. Les descriptions sont rangées bout à bout
+// dans un seul tampon.
+class LotTaches {
+public:
+    // Une date invalide n'est signalée qu'à l'application : tout le lot est
+    // alors refusé.
+    void ajouter(std::string_view description, Priorite priorite, std::string_view dateEcheance) {
+        const auto date = dateDepuisTexte(dateEcheance);
+        operations_.push_back({Type::Ajout, static_cast<std::uint8_t>(priorite), date.has_value(), 0,
+                               static_cast<std::uint32_t>(textes_.size()),
+                               static_cast<std::uint32_t>(description.size()), date.value_or(0)});
+        textes_.append(description);
+        ++nbAjouts_;
+    }
+    void changerStatut(int id, Statut statut) {
+        operations_.push_back({Type::Statut, static_cast<std::uint8_t>(statut), true, id, 0, 0, 0});
+    }
+    void supprimer(int id) {
+        operations_.push_back({Type::Suppression, 0, true, id, 0, 0, 0});
+    }
+
+    std::size_t taille() const {
+        return operations_.size();
+    }
+    void vider() {
+        operations_.clear();
+        textes_.clear();
+        nbAjouts_ = 0;
+    }
+
+    // Rejoue l'état que le lot rencontrerait, sans rien modifier : les
+    // ajouts recevront les ids `prochainId`, `prochainId + 1`... et
+    // `existe(id)` dit si une tâche est présente avant le lot.
+    template <typename Existe>
+    bool valider(int prochainId, Existe&& existe) const {
+        int suivant = prochainId;
+        std::unordered_set<int> supprimees;
+        for (const auto& operation : operations_) {
+            if (operation.type == Type::Ajout) {
+                if (!operation.dateValide) {
+                    return false;
+                }
+                ++suivant;
+                continue;
+            }
+            const bool presente = (existe(operation.id) ||
+                                   (operation.id >= prochainId && operation.id < suivant)) &&
+                                  !supprimees.contains(operation.id);
+            if (!presente) {
+                return false;
+            }
+            if (operation.type == Type::Suppression) {
+                supprimees.insert(operation.id);
+            }
+        }
+        return true;
+    }
+
+private:
+    friend class GestionnaireTaches;
+    friend class MagasinConcurrent;
+
+    enum class Type : std::uint8_t { Ajout, Statut, Suppression };
+    struct Operation {
+        Type type;
+        std::uint8_t valeur;    // priorité (ajout) ou statut
+        bool dateValide;
+        int id;
+        std::uint32_t debut;
+        std::uint32_t longueur;
+        DateCompacte date;
+    };
+
+    std::string_view description(const Operation& operation) const {
+        return std::string_view(textes_).substr(operation.debut, operation.longueur);
+    }
+
+    std::vector<Operation> operations_;
+    std::string textes_;
+    std::size_t nbAjouts_ = 0;
+};
+
+// Les tâches sont rangées en colonnes (TableTaches), dans l'ordre
+// d'insertion. Un index id -> ligne permet de retrouver une tâche en temps
+// constant ; une suppression libère simplement la ligne, et la table n'est
+// compactée (en une seule passe) que lorsque plus de la moitié des lignes
+// sont libres.
+//
+// Avec ouvrirStockage, chaque modification est aussi ajoutée à un journal :
+// sauvegarder ne coûte plus que les changements, et l'instantané n'est
+// réécrit que lorsque le journal devient trop gros (consolider).
+class GestionnaireTaches {
+public:
+    static constexpr std::size_t seuilConsolidation = 16 << 20;
+    static constexpr std::size_t toutes = std::numeric_limits<std::size_t>::max();
+
+    // Renvoie l'id de la nouvelle tâche, ou rien si la date n'est ni vide
+    // ni au format YYYY-MM-DD.
+    std::optional<int> ajouterTache(std::string_view description,
+                                    Priorite priorite,
+                                    std::string_view dateEcheance) {
+        const auto date = dateDepuisTexte(dateEcheance);
+        if (!date) {
+            return std::nullopt;
+        }
+        const int id = prochainId_++;
+        index_.emplace(id, table_.nbLignes());
+        table_.ajouter(id, description, Statut::AFaire, priorite, *date);
+        if (rechercheIndexee_) {
+            recherche_.ajouter(id, description);
+        }
+        if (vuesTriees_) {
+            vues_.ajouter(table_.ligne(table_.nbLignes() - 1));
+        }
+        if (journal_) {
+            journaliserAjout(table_.ligne(table_.nbLignes() - 1));
+        }
+        return id;
+    }
+
+    bool supprimerTache(int id) {
+        auto it = index_.find(id);
+        if (it == index_.end()) {
+            return false;
+        }
+        if (vuesTriees_) {
+            vues_.retirer(table_.ligne(it->second));
+        }
+        table_.liberer(it->second);
+        index_.erase(it);
+        ++nbLibres_;
+        if (nbLibres_ * 2 > table_.nbLignes()) {
+            compacter();
+        }
+        if (rechercheIndexee_) {
+            recherche_.retirer();
+            if (recherche_.nbRetires() > taille()) {
+                reconstruireRecherche();
+            }
+        }
+        if (journal_) {
+            journaliser(OperationJournal::Suppression, id);
+        }
+        return true;
+    }
+    bool changerStatut(int id, Statut statut) {
+        auto it = index_.find(id);
+        if (it == index_.end()) {
+            return false;
+        }
+        table_.changerStatut(it->second, statut);
+        if (journal_) {
+            journaliser(OperationJournal::Statut, id, static_cast<char>(statut));
+        }
+        return true;
+    }
+    // Applique tout le lot, ou rien s'il contient une date invalide ou vise
+    // une tâche absente (y compris supprimée plus tôt dans le lot). Renvoie
+    // les ids des tâches ajoutées, dans l'ordre du lot.
+    // Contrairement à une suite d'appels : la place est réservée une fois,
+    // la table est compactée au plus une fois, les ajouts sont indexés pour
+    // la recherche d'un bloc, un gros lot reconstruit les vues triées d'une
+    // passe au lieu de O(log n) par tâche, et le journal reçoit un seul
+    // enregistrement (rejoué entier ou pas du tout après un arrêt brutal).
+    std::optional<std::vector<int>> appliquer(const LotTaches& lot) {
+        if (!lot.valider(prochainId_, [this](int id) { return index_.contains(id); })) {
+            return std::nullopt;
+        }
+        const bool vuesEnBloc = vuesTriees_ && lot.nbAjouts_ > taille() / 4;
+        const std::size_t premiereLigne = table_.nbLignes();
+        table_.reserverEnPlus(lot.nbAjouts_, lot.textes_.size());
+        if (index_.size() + lot.nbAjouts_ > index_.bucket_count() * index_.max_load_factor()) {
+            index_.reserve(std::max(index_.size() + lot.nbAjouts_, 2 * index_.size()));
+        }
+        if (journal_) {
+            enregistrement_.assign(1, static_cast<char>(OperationJournal::Lot));
+        }
+
+        std::vector<int> ids;
+        ids.reserve(lot.nbAjouts_);
+        for (const auto& operation : lot.operations_) {
+            switch (operation.type) {
+                case LotTaches::Type::Ajout: {
+                    const int id = prochainId_++;
+                    index_.emplace(id, table_.nbLignes());
+                    table_.ajouter(id, lot.description(operation), Statut::AFaire,
+                                   static_cast<Priorite>(operation.valeur), operation.date);
+                    if (vuesTriees_ && !vuesEnBloc) {
+                        vues_.ajouter(table_.ligne(table_.nbLignes() - 1));
+                    }
+                    if (journal_) {
+                        dansLot([&] { encoderAjout(table_.ligne(table_.nbLignes() - 1)); });
+                    }
+                    ids.push_back(id);
+                    break;
+                }
+                case LotTaches::Type::Statut:
+                    table_.changerStatut(index_.find(operation.id)->second,
+                                         static_cast<Statut>(operation.valeur));
+                    if (journal_) {
+                        dansLot([&] {
+                            encoder(OperationJournal::Statut, operation.id,
+                                    static_cast<char>(operation.valeur));
+                        });
+                    }
+                    break;
+                case LotTaches::Type::Suppression: {
+                    const auto it = index_.find(operation.id);
+                    if (vuesTriees_ && !vuesEnBloc) {
+                        vues_.retirer(table_.ligne(it->second));
+                    }
+                    table_.liberer(it->second);
+                    index_.erase(it);
+                    ++nbLibres_;
+                    if (rechercheIndexee_) {
+                        recherche_.retirer();
+                    }
+                    if (journal_) {
+                        dansLot([&] { encoder(OperationJournal::Suppression, operation.id); });
+                    }
+                    break;
+                }
+            }
+        }
+
+        // Les tâches ajoutées occupent les lignes suivant `premiereLigne`
+        // tant que la table n'est pas compactée. Une tâche ajoutée puis
+        // supprimée dans le même lot est indexée quand même : son id est mort.
+        if (rechercheIndexee_) {
+            recherche_.ajouterTous([&](auto&& indexer) {
+                for (std::size_t i = 0; i < ids.size(); ++i) {
+                    indexer(ids[i], table_.description(premiereLigne + i));
+                }
+            });
+            if (recherche_.nbRetires() > taille()) {
+                reconstruireRecherche();
+            }
+        }
+        if (nbLibres_ * 2 > table_.nbLignes()) {
+            compacter();
+        }
+        if (vuesEnBloc) {
+            reconstruireVues();
+        }
+        if (journal_ && lot.taille() > 0) {
+            journal_->ajouter(enregistrement_);
+        }
+        return ids;
+    }
+
+    std::optional<Tache> trouver(int id) const {
+        auto it = index_.find(id);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        return table_.ligne(it->second);
+    }
+    std::size_t taille() const {
+        return index_.size();
+    }
+    const TableTaches& table() const {
+        return table_;
+    }
+    // Avec `limite`, seules les premières tâches sont affichées (et, dans
+    // l'ordre d'insertion ou avec les vues triées, seules elles sont lues).
+    void listerTaches(std::size_t limite = toutes, std::ostream& sortie = std::cout) const {
+        if (index_.empty()) {
+            sortie << "\nAucune tâche pour le moment.\n";
+            return;
+        }
+
+        RenduTaches rendu(sortie);
+        rendu.ajouter("\n=== Liste des tâches ===\n");
+        pourLesPremieres(ordreAffichage_, limite, [&rendu](const Tache& tache) { rendu.ajouter(tache); });
+        rendu.vider();
+        if (limite < taille()) {
+            sortie << "... et " << taille() - limite << " autre(s)\n";
+        }
+    }
+    // Les tâches ne bougent pas : seul l'ordre de listerTaches change.
+    void trierParPriorite() {
+        ordreAffichage_ = Ordre::Priorite;
+    }
+    void trierParDate() {
+        ordreAffichage_ = Ordre::Date;
+    }
+    // Lignes des tâches dont l'échéance est comprise entre `debut` et `fin`
+    // (inclus), par date croissante. Les tâches sans échéance n'y sont jamais.
+    simd::Selection echeancesEntre(DateCompacte debut, DateCompacte fin) const {
+        simd::Selection resultat;
+        pourChaqueEcheance(debut, fin, [&resultat](std::size_t ligne) {
+            resultat.push_back(static_cast<std::uint32_t>(ligne));
+        });
+        return resultat;
+    }
+    // Tâches non terminées dont l'échéance est passée au jour `jour`.
+    simd::Selection enRetard(DateCompacte jour = aujourdhui()) const {
+        simd::Selection resultat;
+        if (jour <= 1) {
+            return resultat;
+        }
+        const auto& statuts = table_.colonnes().statuts;
+        const auto terminee = static_cast<std::uint8_t>(Statut::Terminee);
+        pourChaqueEcheance(1, jour - 1, [&](std::size_t ligne) {
+            if (statuts[ligne] != terminee) {
+                resultat.push_back(static_cast<std::uint32_t>(ligne));
+            }
+        });
+        return resultat;
+    }
+
+    // Des descriptions identiques (« Appeler le client »...) ne sont rangées
+    // qu'une fois, au prix d'une table de hachage des textes : utile quand
+    // les descriptions se répètent beaucoup.
+    void activerInternement(bool actif = true) {
+        internement_ = actif;
+        table_.activerInternement(actif);
+        if (actif) {
+            table_.internerDescriptions();
+        }
+    }
+
+    // Tient à jour les ordres par priorité et par date (VuesTriees) : lister
+    // dans ces ordres devient un parcours, au prix d'une insertion en
+    // O(log n) à chaque ajout ou suppression.
+    void activerVuesTriees(bool actif = true) {
+        vuesTriees_ = actif;
+        if (actif) {
+            reconstruireVues();
+        } else {
+            vues_.vider();
+        }
+    }
+    // Numéros de ligne des tâches dont la description contient `motCle`,
+    // dans l'ordre de la liste. Avec l'index de recherche, seuls les
+    // candidats qu'il propose sont vérifiés ; sinon (ou pour un mot-clé de
+    // moins de 3 octets), toutes les descriptions sont parcourues.
+    simd::Selection rechercherMotCle(std::string_view motCle) const {
+        simd::Selection resultat;
+        if (rechercheIndexee_) {
+            if (const auto candidats = recherche_.candidats(motCle)) {
+                for (const int id : *candidats) {
+                    const auto it = index_.find(id);
+                    if (it != index_.end() &&
+                        table_.description(it->second).find(motCle) != std::string_view::npos) {
+                        resultat.push_back(static_cast<std::uint32_t>(it->second));
+                    }
+                }
+                std::sort(resultat.begin(), resultat.end());
+                return resultat;
+            }
+        }
+        for (std::size_t i = 0; i < table_.nbLignes(); ++i) {
+            if (!table_.estLibre(i) && table_.description(i).find(motCle) != std::string_view::npos) {
+                resultat.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+        return resultat;
+    }
+
+    // L'index des trigrammes accélère rechercherMotCle au prix de quelques
+    // octets par caractère de description ; il est tenu à jour à chaque ajout.
+    void activerIndexRecherche(bool actif = true) {
+        rechercheIndexee_ = actif;
+        if (actif) {
+            reconstruireRecherche();
+        } else {
+            recherche_.vider();
+        }
+    }
+
+    // Numéros de ligne (table().ligne(i)) des tâches ayant ce statut, dans
+    // l'ordre de la liste ; valables jusqu'à la prochaine modification.
+    // Seule la colonne des statuts est lue, 16 ou 32 octets à la fois.
+    simd::Selection filtrerParStatut(Statut statut) const {
+        return table_.selectionnerStatut(statut);
+    }
+    std::array<std::size_t, 3> compterParStatut() const {
+        return table_.compterParStatut();
+    }
+    std::array<std::size_t, 3> compterParPriorite() const {
+        return table_.compterParPriorite();
+    }
+
+    // Tâches qui vérifient tous les critères de `requete`, dans l'ordre de la
+    // liste, lues au fil du parcours. Le critère le plus sélectif (estimé sur
+    // un échantillon) fournit les lignes candidates par le moyen le moins
+    // cher disponible : noyau SIMD sur une colonne, vue triée par date, index
+    // des trigrammes, ou à défaut toutes les lignes. Les autres critères sont
+    // ensuite vérifiés sur chaque candidate.
+    ResultatRequete executer(const RequeteTaches& requete) const {
+        auto plan = planifier(requete);
+        auto lignes = candidates(requete, plan.acces);
+        return ResultatRequete(table_, requete, std::move(plan), std::move(lignes));
+    }
+    PlanRequete planifier(const RequeteTaches& requete) const {
+        const auto& c = table_.colonnes();
+        const EchantillonTaches echantillon(table_);
+        struct Estimation {
+            Critere critere;
+            double selectivite;
+            double cout;    // vérification d'une ligne, relatif à un octet comparé
+        };
+        std::vector<Estimation> estimations;
+        if (requete.statut_) {
+            const auto valeur = static_cast<std::uint8_t>(*requete.statut_);
+            estimations.push_back(
+                {Critere::Statut,
+                 echantillon.selectivite([&](std::size_t i) { return c.statuts[i] == valeur; }), 1});
+        }
+        if (requete.priorite_) {
+            const auto valeur = static_cast<std::uint8_t>(*requete.priorite_);
+            estimations.push_back(
+                {Critere::Priorite,
+                 echantillon.selectivite([&](std::size_t i) { return c.priorites[i] == valeur; }),
+                 1});
+        }
+        if (requete.echeance_) {
+            const auto [debut, fin] = *requete.echeance_;
+            estimations.push_back({Critere::Echeance, echantillon.selectivite([&](std::size_t i) {
+                                       return c.dates[i] >= debut && c.dates[i] <= fin;
+                                   }),
+                                   1});
+        }
+        if (requete.motCle_) {
+            const std::string_view motCle = *requete.motCle_;
+            estimations.push_back({Critere::MotCle, echantillon.selectivite([&](std::size_t i) {
+                                       return table_.description(i).find(motCle) !=
+                                              std::string_view::npos;
+                                   }),
+                                   8});
+        }
+
+        PlanRequete plan;
+        const double n = static_cast<double>(table_.nbLignes());
+        const double taches = static_cast<double>(taille());
+        plan.lignesEstimees = taches;
+        for (const auto& e : estimations) {
+            plan.lignesEstimees *= e.selectivite;
+        }
+
+        // Coût de chaque accès : lignes lues pour produire les candidates,
+        // plus la vérification des autres critères sur chacune d'elles.
+        double meilleurCout = n;
+        std::optional<Critere> servi;
+        for (const auto& e : estimations) {
+            double cout = -1;
+            switch (e.critere) {
+                case Critere::Statut:
+                case Critere::Priorite:
+                    cout = n / 16 + e.selectivite * taches;
+                    break;
+                case Critere::Echeance:
+                    if (vuesTriees_) {
+                        cout = 4 * e.selectivite * taches;
+                    }
+                    break;
+                case Critere::MotCle:
+                    if (rechercheIndexee_ && requete.motCle_->size() >= 3) {
+                        cout = 4 * e.selectivite * taches;
+                    }
+                    break;
+            }
+            if (cout >= 0 && cout < meilleurCout) {
+                meilleurCout = cout;
+                servi = e.critere;
+            }
+        }
+        if (servi) {
+            constexpr PlanRequete::Acces acces[] = {
+                PlanRequete::Acces::Statut, PlanRequete::Acces::Priorite,
+                PlanRequete::Acces::Echeances, PlanRequete::Acces::Trigrammes};
+            plan.acces = acces[static_cast<std::size_t>(*servi)];
+        }
+
+        // L'index des trigrammes ne propose que des candidats : le mot-clé
+        // reste à vérifier. Les autres accès ne rendent que des lignes
+        // conformes à leur critère.
+        std::erase_if(estimations, [&](const Estimation& e) {
+            return servi == e.critere && e.critere != Critere::MotCle;
+        });
+        std::sort(estimations.begin(), estimations.end(), [](const Estimation& a, const Estimation& b) {
+            return a.cout / (1 - a.selectivite) < b.cout / (1 - b.selectivite);
+        });
+        for (const auto& e : estimations) {
+            plan.filtres.push_back(e.critere);
+        }
+        return plan;
+    }
+    bool sauvegarderCSV(const std::filesystem::path& fichier) const {
+        std::ofstream sortie(fichier);
+        if (!sortie) {
+            return false;
+        }
+
+        pourChaqueTache([&sortie](const Tache& tache) {
+            sortie << tache.id << ';'
+                   << std::quoted(tache.description) << ';'
+                   << versTexte(tache.statut) << ';'
+                   << versTexte(tache.priorite) << ';'
+                   << dateVersTexte(tache.dateEcheance) << '\n';
+        });
+        return true;
+    }
+
+    bool chargerCSV(const std::filesystem::path& fichier,
+                    ModeChargement mode = ModeChargement::Projection,
+                    unsigned nbThreads = nombreThreadsParDefaut()) {
+        if (!std::filesystem::exists(fichier)) {
+            return false;
+        }
+
+        if (mode == ModeChargement::Projection) {
+            FichierProjete projection(fichier);
+            if (!projection.ouvert()) {
+                return false;
+            }
+            // Quelques morceaux de plus que de threads pour équilibrer la
+            // charge, mais pas de morceaux minuscules sur un petit fichier.
+            constexpr std::size_t tailleMinMorceau = 1 << 20;
+            const std::size_t nbMorceaux = std::min<std::size_t>(
+                std::size_t{nbThreads} * 4, projection.contenu().size() / tailleMinMorceau + 1);
+            const auto morceaux = decouperEnMorceaux(projection.contenu(), nbMorceaux);
+
+            std::vector<TableTaches> resultats(morceaux.size());
+            std::vector<BilanChargement> bilans(morceaux.size());
+            executerEnParallele(morceaux.size(), nbThreads, [&](std::size_t i) {
+                resultats[i] = analyserMorceauCSV(morceaux[i], bilans[i]);
+            });
+            bilanChargement_ = {};
+            for (const auto& bilan : bilans) {
+                bilanChargement_ += bilan;
+            }
+
+            remplacerTable(TableTaches::concatener(resultats, nbThreads));
+            return apresRemplacement();
+        }
+
+        std::ifstream entree(fichier);
+        if (!entree) {
+            return false;
+        }
+
+        TableTaches table;
+        bilanChargement_ = {};
+        std::string ligne;
+        while (std::getline(entree, ligne)) {
+            if (!ligne.empty()) {
+                analyserLigneCSV(ligne, table, bilanChargement_);
+            }
+        }
+        remplacerTable(std::move(table));
+        return apresRemplacement();
+    }
+
+    // Lignes ignorées et dates illisibles du dernier chargerCSV ou
+    // chargerInstantane réussi.
+    const BilanChargement& bilanChargement() const {
+        return bilanChargement_;
+    }
+
+    // Écrit tout l'instantané dans un seul tampon, puis en une seule écriture.
+    // Une description internée n'est écrite qu'une fois. Une description vide
+    // n'occupe rien dans l'arène : son adresse peut être celle du texte
+    // suivant, elle n'entre donc pas dans la table des textes partagés.
+    bool sauvegarderInstantane(const std::filesystem::path& fichier) const {
+        if constexpr (std::endian::native != std::endian::little) {
+            return false;
+        }
+        const bool partager = table_.internementActif();
+        const std::size_t n = taille();
+        std::size_t tailleTas = 0;
+        std::unordered_map<const char*, std::uint64_t> partagees;
+        pourChaqueTache([&](const Tache& t) {
+            if (!partager || t.description.empty() ||
+                partagees.try_emplace(t.description.data(), tailleTas).second) {
+                tailleTas += t.description.size();
+            }
+        });
+
+        std::vector<char> tampon(instantane::tailleEnTete + n * instantane::octetsParTache + tailleTas);
+        char* const base = tampon.data();
+        std::memcpy(base, instantane::magique, sizeof(instantane::magique));
+        instantane::ecrire<std::uint32_t>(base + 8, instantane::version);
+        instantane::ecrire<std::uint32_t>(base + 12, generation_);
+        instantane::ecrire<std::uint64_t>(base + 16, n);
+        instantane::ecrire<std::uint64_t>(base + 24, tailleTas);
+
+        char* const debuts = base + instantane::tailleEnTete;
+        char* const longueurs = debuts + 8 * n;
+        char* const ids = longueurs + 4 * n;
+        char* const dates = ids + 4 * n;
+        char* const statuts = dates + 4 * n;
+        char* const priorites = statuts + n;
+        char* const tas = priorites + n;
+
+        std::size_t ligne = 0;
+        std::uint64_t position = 0;
+        pourChaqueTache([&](const Tache& t) {
+            std::uint64_t debut = position;
+            if (partager && !t.description.empty()) {
+                debut = partagees.find(t.description.data())->second;
+            }
+            if (debut == position) {
+                std::memcpy(tas + position, t.description.data(), t.description.size());
+                position += t.description.size();
+            }
+            instantane::ecrire<std::uint64_t>(debuts + 8 * ligne, debut);
+            instantane::ecrire<std::uint32_t>(longueurs + 4 * ligne,
+                                              static_cast<std::uint32_t>(t.description.size()));
+            instantane::ecrire<std::int32_t>(ids + 4 * ligne, t.id);
+            instantane::ecrire<DateCompacte>(dates + 4 * ligne, t.dateEcheance);
+            statuts[ligne] = static_cast<char>(t.statut);
+            priorites[ligne] = static_cast<char>(t.priorite);
+            ++ligne;
+        });
+
+        std::ofstream sortie(fichier, std::ios::binary);
+        sortie.write(tampon.data(), static_cast<std::streamsize>(tampon.size()));
+        // Une erreur peut n'apparaître qu'au vidage du tampon, à la fermeture.
+        sortie.close();
+        return static_cast<bool>(sortie);
+    }
+
+    // Projette le fichier et recopie directement les colonnes.
+    // Un fichier tronqué ou incohérent est refusé sans toucher aux tâches.
+    bool chargerInstantane(const std::filesystem::path& fichier) {
+        if constexpr (std::endian::native != std::endian::little) {
+            return false;
+        }
+        FichierProjete projection(fichier);
+        const std::string_view donnees = projection.contenu();
+        if (!projection.ouvert() || donnees.size() < instantane::tailleEnTete ||
+            std::memcmp(donnees.data(), instantane::magique, sizeof(instantane::magique)) != 0) {
+            return false;
+        }
+        const auto version = instantane::lire<std::uint32_t>(donnees.data() + 8);
+        const auto n = instantane::lire<std::uint64_t>(donnees.data() + 16);
+        const auto tailleTas = instantane::lire<std::uint64_t>(donnees.data() + 24);
+        if (version != instantane::version) {
+            return false;
+        }
+        BilanChargement bilan;
+        auto colonnes = instantane::lireColonnes(donnees, n, tailleTas, bilan.datesIgnorees);
+        if (!colonnes) {
+            return false;
+        }
+        bilanChargement_ = bilan;
+
+        remplacerTable(TableTaches(std::move(*colonnes)));
+        generation_ = instantane::lire<std::uint32_t>(donnees.data() + 12);
+        return apresRemplacement();
+    }
+
+    // Charge l'instantané (ou, s'il n'existe pas encore, fait du contenu
+    // actuel le premier instantané), rejoue le journal par-dessus, puis
+    // journalise toutes les modifications suivantes. Sans instantané, un
+    // journal resté là complétait un instantané disparu : rejoué sur le
+    // contenu actuel, il dupliquerait ou supprimerait des tâches, il est
+    // donc effacé.
+    bool ouvrirStockage(const std::filesystem::path& instantane,
+                        const std::filesystem::path& cheminJournal) {
+        journal_.reset();
+        if (std::filesystem::exists(instantane)) {
+            std::error_code erreur;
+            tailleInstantane_ = std::filesystem::file_size(instantane, erreur);
+            if (erreur || !chargerInstantane(instantane)) {
+                return false;
+            }
+        } else {
+            std::error_code erreur;
+            std::filesystem::remove(cheminJournal, erreur);
+            if (erreur || !ecrireInstantaneDurable(instantane)) {
+                return false;
+            }
+        }
+
+        std::size_t tailleValide = 0;
+        const auto relecture = journal::relire(cheminJournal, generation_, tailleValide,
+                                               [this](std::string_view contenu) {
+                                                   rejouer(contenu);
+                                               });
+        if (relecture == journal::Relecture::Invalide) {
+            return false;
+        }
+        if (relecture == journal::Relecture::Relu) {
+            // Tronque un éventuel enregistrement déchiré par un arrêt brutal.
+            std::filesystem::resize_file(cheminJournal, tailleValide);
+        }
+
+        auto nouveauJournal = std::make_unique<Journal>();
+        if (!nouveauJournal->ouvrir(cheminJournal, generation_,
+                                    relecture != journal::Relecture::Relu)) {
+            return false;
+        }
+        journal_ = std::move(nouveauJournal);
+        cheminInstantane_ = instantane;
+        cheminJournal_ = cheminJournal;
+        return true;
+    }
+
+    // Coût proportionnel aux modifications depuis la dernière synchronisation.
+    bool synchroniser() {
+        if (!journal_ || !journal_->synchroniser()) {
+            return false;
+        }
+        if (journal_->taille() > std::max(seuilConsolidation, tailleInstantane_)) {
+            return consolider();
+        }
+        return true;
+    }
+
+    // Intègre le journal dans un nouvel instantané, puis repart d'un journal
+    // vide. L'instantané est remplacé par rename : un arrêt brutal laisse
+    // soit l'ancien couple instantané + journal, soit le nouveau.
+    bool consolider() {
+        if (!journal_ || !journal_->synchroniser()) {
+            return false;
+        }
+        ++generation_;
+        if (!ecrireInstantaneDurable(cheminInstantane_)) {
+            --generation_;
+            return false;
+        }
+        return journal_->ouvrir(cheminJournal_, generation_, true);
+    }
+
+    template <typename Fonction>
+    void pourChaqueTache(Fonction&& fonction) const {
+        for (std::size_t i = 0; i < table_.nbLignes(); ++i) {
+            if (!table_.estLibre(i)) {
+                fonction(table_.ligne(i));
+            }
+        }
+    }
+
+    // À clé égale, les tâches viennent dans l'ordre de leurs ids. Sans les
+    // vues triées, l'ordre est calculé à chaque appel.
+    template <typename Fonction>
+    void pourChaqueTache(Ordre ordre, Fonction&& fonction) const {
+        pourLesPremieres(ordre, toutes, fonction);
+    }
+
+    // Les `limite` premières tâches dans l'ordre demandé. Dans l'ordre
+    // d'insertion ou avec les vues triées, le parcours s'arrête à la
+    // dernière ; sinon seules les `limite` premières sont triées
+    // (std::partial_sort).
+    template <typename Fonction>
+    void pourLesPremieres(Ordre ordre, std::size_t limite, Fonction&& fonction) const {
+        if (ordre == Ordre::Insertion) {
+            for (std::size_t i = 0; i < table_.nbLignes() && limite > 0; ++i) {
+                if (!table_.estLibre(i)) {
+                    fonction(table_.ligne(i));
+                    --limite;
+                }
+            }
+        } else if (vuesTriees_) {
+            vues_.parcourir(
+                ordre, [&](int id) { fonction(table_.ligne(index_.find(id)->second)); }, limite);
+        } else {
+            for (const auto ligne : premieresLignes(limite, ordre, [](std::size_t) { return true; }, 1)) {
+                fonction(table_.ligne(ligne));
+            }
+        }
+    }
+
+    // Lignes des `k` premières tâches dans l'ordre `ordre` parmi celles que
+    // retient `filtre` (appelé sur chaque Tache), sans trier ni déplacer les
+    // autres. Avec les vues triées (ou dans l'ordre d'insertion), le
+    // parcours s'arrête à la k-ième tâche retenue. Sinon chaque morceau de
+    // la table garde ses k meilleures lignes dans un tas borné, O(n log k),
+    // sur `nbThreads` threads, et les meilleures des morceaux sont triées
+    // pour finir.
+    template <typename Filtre>
+    simd::Selection topK(std::size_t k, Ordre ordre, Filtre&& filtre, unsigned nbThreads = 1) const {
+        auto retenir = [&](std::size_t ligne) { return filtre(table_.ligne(ligne)); };
+        if (ordre == Ordre::Insertion || vuesTriees_) {
+            simd::Selection resultat;
+            auto ajouter = [&](std::size_t ligne) {
+                if (resultat.size() < k && retenir(ligne)) {
+                    resultat.push_back(static_cast<std::uint32_t>(ligne));
+                }
+                return resultat.size() < k;
+            };
+            if (ordre == Ordre::Insertion) {
+                for (std::size_t i = 0; i < table_.nbLignes() && k > 0; ++i) {
+                    if (!table_.estLibre(i) && !ajouter(i)) {
+                        break;
+                    }
+                }
+            } else {
+                vues_.parcourir(ordre, [&](int id) { return ajouter(index_.find(id)->second); });
+            }
+            return resultat;
+        }
+        return premieresLignes(k, ordre, retenir, nbThreads);
+    }
+    simd::Selection topK(std::size_t k, Ordre ordre) const {
+        return topK(k, ordre, [](const Tache&) { return true; });
+    }
+
+    // Pour une ligne isolée ; pour en afficher beaucoup, un même
+    // RenduTaches évite de vider le tampon à chaque ligne.
+    static void afficherTache(const Tache& tache, std::ostream& sortie = std::cout) {
+        RenduTaches(sortie).ajouter(tache);
+    }
+
+private:
+    enum class OperationJournal : char {
+        Ajout = 1,
+        Suppression = 2,
+        Statut = 3,
+        Lot = 4    // type | (longueur u32 | enregistrement)...
+    };
+
+    template <typename T>
+    void ajouterBrut(T valeur) {
+        char octets[sizeof(T)];
+        std::memcpy(octets, &valeur, sizeof(T));
+        enregistrement_.append(octets, sizeof(T));
+    }
+
+    void journaliser(OperationJournal operation, std::int32_t id, char valeur = 0) {
+        enregistrement_.clear();
+        encoder(operation, id, valeur);
+        journal_->ajouter(enregistrement_);
+    }
+    void encoder(OperationJournal operation, std::int32_t id, char valeur = 0) {
+        enregistrement_ += static_cast<char>(operation);
+        ajouterBrut(id);
+        if (operation == OperationJournal::Statut) {
+            enregistrement_ += valeur;
+        }
+    }
+
+    // Ajout : type | id i32 | priorite u8 | longueur description u32 | description | date
+    // La date reste en texte ISO : le format du journal ne dépend pas de la
+    // représentation en mémoire.
+    void journaliserAjout(const Tache& tache) {
+        enregistrement_.clear();
+        encoderAjout(tache);
+        journal_->ajouter(enregistrement_);
+    }
+    void encoderAjout(const Tache& tache) {
+        enregistrement_ += static_cast<char>(OperationJournal::Ajout);
+        ajouterBrut(static_cast<std::int32_t>(tache.id));
+        enregistrement_ += static_cast<char>(tache.priorite);
+        ajouterBrut(static_cast<std::uint32_t>(tache.description.size()));
+        enregistrement_ += tache.description;
+        enregistrement_ += dateVersTexte(tache.dateEcheance);
+    }
+
+    // Ajoute à l'enregistrement du lot ce qu'écrit `encoder`, précédé de sa
+    // longueur.
+    template <typename Encodeur>
+    void dansLot(Encodeur&& encoder) {
+        const std::size_t debut = enregistrement_.size();
+        ajouterBrut(std::uint32_t{0});
+        encoder();
+        const auto longueur = static_cast<std::uint32_t>(enregistrement_.size() - debut - 4);
+        std::memcpy(enregistrement_.data() + debut, &longueur, sizeof(longueur));
+    }
+
+    // Appelé pendant la relecture, journal fermé : rien n'est re-journalisé.
+    void rejouer(std::string_view contenu) {
+        if (!contenu.empty() && static_cast<OperationJournal>(contenu[0]) == OperationJournal::Lot) {
+            for (std::size_t position = 1; contenu.size() - position >= 4;) {
+                const auto longueur = instantane::lire<std::uint32_t>(contenu.data() + position);
+                if (longueur > contenu.size() - position - 4) {
+                    return;
+                }
+                rejouer(contenu.substr(position + 4, longueur));
+                position += 4 + longueur;
+            }
+            return;
+        }
+        if (contenu.size() < 5) {
+            return;
+        }
+        const auto operation = static_cast<OperationJournal>(contenu[0]);
+        const auto id = instantane::lire<std::int32_t>(contenu.data() + 1);
+        switch (operation) {
+            case OperationJournal::Ajout: {
+                if (contenu.size() < 10) {
+                    return;
+                }
+                const auto priorite = static_cast<unsigned char>(contenu[5]);
+                const auto longueur = instantane::lire<std::uint32_t>(contenu.data() + 6);
+                if (priorite < 1 || priorite > 3 || longueur > contenu.size() - 10) {
+                    return;
+                }
+                const auto date = dateDepuisTexte(contenu.substr(10 + longueur));
+                if (!date || index_.contains(id)) {
+                    return;
+                }
+                index_.emplace(id, table_.nbLignes());
+                table_.ajouter(id, contenu.substr(10, longueur), Statut::AFaire,
+                               static_cast<Priorite>(priorite), *date);
+                if (rechercheIndexee_) {
+                    recherche_.ajouter(id, contenu.substr(10, longueur));
+                }
+                if (vuesTriees_) {
+                    vues_.ajouter(table_.ligne(table_.nbLignes() - 1));
+                }
+                prochainId_ = std::max(prochainId_, id + 1);
+                break;
+            }
+            case OperationJournal::Suppression:
+                supprimerTache(id);
+                break;
+            case OperationJournal::Statut:
+                if (contenu.size() == 6 && static_cast<unsigned char>(contenu[5]) <= 2) {
+                    changerStatut(id, static_cast<Statut>(contenu[5]));
+                }
+                break;
+            case OperationJournal::Lot:
+                break;
+        }
+    }
+
+    // Après un chargement complet, le journal ouvert ne décrit plus l'état.
+    bool apresRemplacement() {
+        return journal_ ? consolider() : true;
+    }
+
+    bool ecrireInstantaneDurable(const std::filesystem::path& chemin) {
+        auto temporaire = chemin;
+        temporaire += ".tmp";
+        if (!sauvegarderInstantane(temporaire) || !forcerSurDisque(temporaire)) {
+            return false;
+        }
+        std::error_code erreur;
+        std::filesystem::rename(temporaire, chemin, erreur);
+        if (erreur) {
+            return false;
+        }
+        const auto dossier = chemin.parent_path();
+        forcerSurDisque(dossier.empty() ? std::filesystem::path(".") : dossier);
+        tailleInstantane_ = std::filesystem::file_size(chemin, erreur);
+        return !erreur;
+    }
+
+    // Remplace tout le contenu (chargement). Un id déjà vu ne serait plus un
+    // identifiant : on garde sa première occurrence et on libère les autres.
+    void remplacerTable(TableTaches table) {
+        table_ = std::move(table);
+        nbLibres_ = 0;
+        prochainId_ = 1;
+        for (std::size_t i = 0; i < table_.nbLignes(); ++i) {
+            nbLibres_ += table_.estLibre(i);
+        }
+        reconstruireIndex();
+        const auto& ids = table_.colonnes().ids;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            if (!table_.estLibre(i)) {
+                prochainId_ = std::max(prochainId_, ids[i] + 1);
+            }
+        }
+        table_.activerInternement(internement_);
+        if (nbLibres_ * 2 > table_.nbLignes()) {
+            compacter();
+        } else if (internement_) {
+            table_.internerDescriptions();
+        }
+        if (rechercheIndexee_) {
+            reconstruireRecherche();
+        }
+        if (vuesTriees_) {
+            reconstruireVues();
+        }
+    }
+
+    // Avec les vues triées : recherche dichotomique puis parcours de
+    // l'intervalle. Sans elles : parcours de la colonne des dates, puis tri
+    // des seules lignes retenues.
+    template <typename Fonction>
+    void pourChaqueEcheance(DateCompacte debut, DateCompacte fin, Fonction&& fonction) const {
+        debut = std::max<DateCompacte>(debut, 1);
+        if (debut > fin) {
+            return;
+        }
+        if (vuesTriees_) {
+            vues_.parcourirEcheances(debut, fin, [&](int id) { fonction(index_.find(id)->second); });
+            return;
+        }
+        const auto& c = table_.colonnes();
+        std::vector<std::size_t> lignes;
+        for (std::size_t i = 0; i < c.dates.size(); ++i) {
+            if (c.dates[i] >= debut && c.dates[i] <= fin && !table_.estLibre(i)) {
+                lignes.push_back(i);
+            }
+        }
+        std::sort(lignes.begin(), lignes.end(), [&c](std::size_t a, std::size_t b) {
+            return c.dates[a] != c.dates[b] ? c.dates[a] < c.dates[b] : c.ids[a] < c.ids[b];
+        });
+        for (const std::size_t i : lignes) {
+            fonction(i);
+        }
+    }
+
+    // Ordre strict des lignes pour un tri par priorité (la plus haute
+    // d'abord) ou par date, à égalité par id.
+    auto comparateur(Ordre ordre) const {
+        const auto& c = table_.colonnes();
+        return [&c, ordre](std::size_t a, std::size_t b) {
+            if (ordre == Ordre::Priorite && c.priorites[a] != c.priorites[b]) {
+                return c.priorites[a] > c.priorites[b];
+            }
+            if (ordre == Ordre::Date && c.dates[a] != c.dates[b]) {
+                return c.dates[a] < c.dates[b];
+            }
+            return c.ids[a] < c.ids[b];
+        };
+    }
+
+    // Tas borné par morceau : sa tête est la moins bonne des k lignes
+    // gardées, et une ligne qui ne la bat pas coûte une comparaison.
+    template <typename Retenir>
+    simd::Selection premieresLignes(std::size_t k, Ordre ordre, Retenir&& retenir,
+                                    unsigned nbThreads) const {
+        const auto avant = comparateur(ordre);
+        constexpr std::size_t tailleMinMorceau = 1 << 16;
+        const std::size_t n = table_.nbLignes();
+        const std::size_t nbMorceaux =
+            std::max<std::size_t>(1, std::min<std::size_t>(nbThreads, n / tailleMinMorceau));
+        std::vector<simd::Selection> tas(nbMorceaux);
+        executerEnParallele(nbMorceaux, nbThreads, [&](std::size_t m) {
+            auto& meilleures = tas[m];
+            meilleures.reserve(std::min(k, n));
+            for (std::size_t i = n * m / nbMorceaux; i < n * (m + 1) / nbMorceaux && k > 0; ++i) {
+                if (table_.estLibre(i) || (meilleures.size() == k && !avant(i, meilleures.front())) ||
+                    !retenir(i)) {
+                    continue;
+                }
+                if (meilleures.size() == k) {
+                    std::pop_heap(meilleures.begin(), meilleures.end(), avant);
+                    meilleures.back() = static_cast<std::uint32_t>(i);
+                } else {
+                    meilleures.push_back(static_cast<std::uint32_t>(i));
+                }
+                std::push_heap(meilleures.begin(), meilleures.end(), avant);
+            }
+        });
+        simd::Selection resultat = std::move(tas[0]);
+        for (std::size_t m = 1; m < nbMorceaux; ++m) {
+            resultat.insert(resultat.end(), tas[m].begin(), tas[m].end());
+        }
+        const auto fin = resultat.begin() + static_cast<std::ptrdiff_t>(std::min(k, resultat.size()));
+        std::partial_sort(resultat.begin(), fin, resultat.end(), avant);
+        resultat.erase(fin, resultat.end());
+        return resultat;
+    }
+
+    // Lignes candidates selon l'accès choisi, triées (ordre de la liste) ;
+    // rien pour un parcours de toutes les lignes.
+    std::optional<simd::Selection> candidates(const RequeteTaches& requete,
+                                              PlanRequete::Acces acces) const {
+        const auto& c = table_.colonnes();
+        simd::Selection lignes;
+        switch (acces) {
+            case PlanRequete::Acces::Parcours:
+                return std::nullopt;
+            case PlanRequete::Acces::Statut:
+                return simd::selectionnerEgal(c.statuts.data(), table_.nbLignes(),
+                                              static_cast<std::uint8_t>(*requete.statut_));
+            case PlanRequete::Acces::Priorite:
+                return simd::selectionnerEgal(c.priorites.data(), table_.nbLignes(),
+                                              static_cast<std::uint8_t>(*requete.priorite_));
+            case PlanRequete::Acces::Echeances:
+                pourChaqueEcheance(requete.echeance_->first, requete.echeance_->second,
+                                   [&lignes](std::size_t ligne) {
+                                       lignes.push_back(static_cast<std::uint32_t>(ligne));
+                                   });
+                break;
+            case PlanRequete::Acces::Trigrammes:
+                if (const auto ids = recherche_.candidats(*requete.motCle_)) {
+                    for (const int id : *ids) {
+                        if (const auto it = index_.find(id); it != index_.end()) {
+                            lignes.push_back(static_cast<std::uint32_t>(it->second));
+                        }
+                    }
+                }
+                break;
+        }
+        std::sort(lignes.begin(), lignes.end());
+        return lignes;
+    }
+
+    void reconstruireVues() {
+        vues_.construire([this](auto&& ajouter) { pourChaqueTache(ajouter); });
+    }
+
+    void reconstruireRecherche() {
+        recherche_.construire([this](auto&& indexer) {
+            pourChaqueTache([&indexer](const Tache& t) { indexer(t.id, t.description); });
+        });
+    }
+
+    void compacter() {
+        table_.compacter();
+        nbLibres_ = 0;
+        reconstruireIndex();
+    }
+
+    void reconstruireIndex() {
+        index_.clear();
+        index_.reserve(table_.nbLignes());
+        const auto& ids = table_.colonnes().ids;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            if (!table_.estLibre(i) && !index_.emplace(ids[i], i).second) {
+                table_.liberer(i);
+                ++nbLibres_;
+            }
+        }
+    }
+
+    TableTaches table_;
+    std::unordered_map<int, std::size_t> index_;
+    std::size_t nbLibres_ = 0;
+    int prochainId_ = 1;
+    IndexTrigrammes recherche_;
+    bool rechercheIndexee_ = false;
+    VuesTriees vues_;
+    bool vuesTriees_ = false;
+    bool internement_ = false;
+    Ordre ordreAffichage_ = Ordre::Insertion;
+    BilanChargement bilanChargement_;
+
+    std::unique_ptr<Journal> journal_;
+    std::string enregistrement_;
+    std::filesystem::path cheminInstantane_;
+    std::filesystem::path cheminJournal_;
+    std::uint32_t generation_ = 0;
+    std::size_t tailleInstantane_ = 0;
+};
@@ -1,225 +1,16 @@
-#include <algorithm>
+#include <csignal>
 #include <filesystem>
 #include <fstream>
-#include <iomanip>
 #include <iostream>
 #include <optional>
-#include <sstream>
 #include <string>
-#include <vector>
-enum class Statut {
-    AFaire,
-    EnCours,
-    Terminee
-};
-enum class Priorite {
-    Basse = 1,
-    Moyenne = 2,
-    Haute = 3
-};
-struct Tache {
-    int id;
-    std::string description;
-    Statut statut;
-    Priorite priorite;
-    std::string dateEcheance; // Format ISO : YYYY-MM-DD
-};
-std::string versTexte(Statut statut) {
-    switch (statut) {
-        case Statut::AFaire:
-            return "A_FAIRE";
-        case Statut::EnCours:
-            return "EN_COURS";
-        case Statut::Terminee:
-            return "TERMINEE";
-    }
-    return "A_FAIRE";
-}
-std::string versTexte(Priorite priorite) {
-    switch (priorite) {
-        case Priorite::Basse:
-            return "BASSE";
-        case Priorite::Moyenne:
-            return "MOYENNE";
-        case Priorite::Haute:
-            return "HAUTE";
-    }
-    return "MOYENNE";
-}
-std::optional<Statut> statutDepuisTexte(const std::string& texte) {
-    if (texte == "A_FAIRE") {
-        return Statut::AFaire;
-    }
-    if (texte == "EN_COURS") {
-        return Statut::EnCours;
-    }
-    if (texte == "TERMINEE") {
-        return Statut::Terminee;
-    }
-    return std::nullopt;
-}
-std::optional<Priorite> prioriteDepuisTexte(const std::string& texte) {
-    if (texte == "BASSE") {
-        return Priorite::Basse;
-    }
-    if (texte == "MOYENNE") {
-        return Priorite::Moyenne;
-    }
-    if (texte == "HAUTE") {
-        return Priorite::Haute;
-    }
-    return std::nullopt;
-}
-
-class GestionnaireTaches {
-public:
-    void ajouterTache(const std::string& description,
-                      Priorite priorite,
-                      const std::string& dateEcheance) {
-        taches_.push_back({prochainId_++, description, Statut::AFaire, priorite, dateEcheance});
-    }
-
-    bool supprimerTache(int id) {
-        auto fin = std::remove_if(taches_.begin(), taches_.end(),
-                                  [id](const auto& t) { return t.id == id; });
-        if (fin == taches_.end()) {
-            return false;
-        }
-        taches_.erase(fin, taches_.end());
-        return true;
-    }
-    bool changerStatut(int id, Statut statut) {
-        auto it = trouverTache(id);
-        if (it == taches_.end()) {
-            return false;
-        }
-        it->statut = statut;
-        return true;
-    }
-    void listerTaches() const {
-        if (taches_.empty()) {
-            std::cout << "\nAucune tâche pour le moment.\n";
-            return;
-        }
-
-        std::cout << "\n=== Liste des tâches ===\n";
-        for (const auto& tache : taches_) {
-            afficherTache(tache);
-        }
-    }
-    void trierParPriorite() {
-        std::sort(taches_.begin(), taches_.end(), [](const auto& a, const auto& b) {
-            return static_cast<int>(a.priorite) > static_cast<int>(b.priorite);
-        });
-    }
-    void trierParDate() {
-        std::sort(taches_.begin(), taches_.end(), [](const auto& a, const auto& b) {
-            return a.dateEcheance < b.dateEcheance;
-        });
-    }
-    std::vector<Tache> rechercherMotCle(const std::string& motCle) const {
-        std::vector<Tache> resultat;
-        std::copy_if(taches_.begin(), taches_.end(), std::back_inserter(resultat),
-                     [&motCle](const auto& t) {
-                         return t.description.find(motCle) != std::string::npos;
-                     });
-        return resultat;
-    }
-    std::vector<Tache> filtrerParStatut(Statut statut) const {
-        std::vector<Tache> resultat;
-        std::copy_if(taches_.begin(), taches_.end(), std::back_inserter(resultat),
-                     [statut](const auto& t) { return t.statut == statut; });
-        return resultat;
-    }
-    bool sauvegarderCSV(const std::filesystem::path& fichier) const {
-        std::ofstream sortie(fichier);
-        if (!sortie) {
-            return false;
-        }
-
-        for (const auto& tache : taches_) {
-            sortie << tache.id << ';'
-                   << std::quoted(tache.description) << ';'
-                   << versTexte(tache.statut) << ';'
-                   << versTexte(tache.priorite) << ';'
-                   << tache.dateEcheance << '\n';
-        }
-        return true;
-    }
-
-    bool chargerCSV(const std::filesystem::path& fichier) {
-        if (!std::filesystem::exists(fichier)) {
-            return false;
-        }
-
-        std::ifstream entree(fichier);
-        if (!entree) {
-            return false;
-        }
+#include <string_view>
 
-        taches_.clear();
-        prochainId_ = 1;
-
-        std::string ligne;
-        while (std::getline(entree, ligne)) {
-            if (ligne.empty()) {
-                continue;
-            }
-
-            std::stringstream buffer(ligne);
-            std::string idStr;
-            std::string description;
-            std::string statutStr;
-            std::string prioriteStr;
-            std::string dateStr;
-
-            if (!std::getline(buffer, idStr, ';') ||
-                !std::getline(buffer, description, ';') ||
-                !std::getline(buffer, statutStr, ';') ||
-                !std::getline(buffer, prioriteStr, ';') ||
-                !std::getline(buffer, dateStr)) {
-                continue;
-            }
-
-            int id = 0;
-            try {
-                id = std::stoi(idStr);
-            } catch (const std::exception&) {
-                continue;
-            }
-
-            std::stringstream descStream(description);
-            std::string descriptionDecodee;
-            descStream >> std::quoted(descriptionDecodee);
-
-            auto statut = statutDepuisTexte(statutStr);
-            auto priorite = prioriteDepuisTexte(prioriteStr);
-            if (!statut || !priorite) {
-                continue;
-            }
-
-            taches_.push_back({id, descriptionDecodee, *statut, *priorite, dateStr});
-            prochainId_ = std::max(prochainId_, id + 1);
-        }
-        return true;
-    }
-
-    static void afficherTache(const Tache& tache) {
-        std::cout << "- [" << tache.id << "] " << std::setw(30) << std::left
-                  << tache.description << " | " << std::setw(8)
-                  << versTexte(tache.statut) << " | " << std::setw(7)
-                  << versTexte(tache.priorite) << " | " << tache.dateEcheance << "\n";
-    }
-
-private:
-    std::vector<Tache>::iterator trouverTache(int id) {
-        return std::find_if(taches_.begin(), taches_.end(),
-                            [id](const auto& t) { return t.id == id; });
-    }
-
-    std::vector<Tache> taches_;
-    int prochainId_ = 1;
-};
+#include "commandes.hpp"
+#include "taches.hpp"
+#if defined(__linux__)
+#include "serveur_taches.hpp"
+#endif
 
 std::string lireLigne(const std::string& message) {
     std::cout << message;
@@ -269,6 +60,27 @@ Statut demanderStatut() {
     return Statut::AFaire;
 }
 
+std::optional<DateCompacte> demanderDate(const std::string& message) {
+    auto date = dateDepuisTexte(lireLigne(message));
+    if (!date || *date == sansEcheance) {
+        std::cout << "Date invalide (format YYYY-MM-DD).\n";
+        return std::nullopt;
+    }
+    return date;
+}
+
+void afficherLignes(const GestionnaireTaches& gestionnaire, const simd::Selection& lignes,
+                    std::string_view siVide = "Aucune tâche.") {
+    RenduTaches rendu;
+    for (const auto ligne : lignes) {
+        rendu.ajouter(gestionnaire.table().ligne(ligne));
+    }
+    if (lignes.empty()) {
+        rendu.ajouter(siVide);
+        rendu.ajouter("\n");
+    }
+}
+
 void afficherMenu() {
     std::cout << "\n=== Todo App Console ===\n"
               << "1. Ajouter une tâche\n"
@@ -280,15 +92,99 @@ void afficherMenu() {
               << "7. Rechercher par mot-clé\n"
               << "8. Filtrer par statut\n"
               << "9. Sauvegarder\n"
-              << "10. Quitter\n";
+              << "10. Quitter\n"
+              << "11. Échéances entre deux dates\n"
+              << "12. Tâches en retard\n";
 }
 
-int main() {
-    const std::filesystem::path fichier = "taches.csv";
+#if defined(__linux__)
+ServeurTaches* serveurActif = nullptr;
+#endif
+
+// ./todo --exporter-csv [fichier] : écrit toutes les tâches en CSV (par
+// défaut taches.csv), pour les échanger avec un autre programme.
+// ./todo --commandes [fichier] : exécute les commandes du fichier (ou de
+// l'entrée standard) sans menu ni question ; voir commandes.hpp.
+// ./todo --serveur [socket] (Linux seulement) : garde les tâches en mémoire
+// et répond aux clients (client_taches.hpp) jusqu'à Ctrl+C ; voir
+// serveur_taches.hpp.
+int main(int argc, char* argv[]) {
+    const std::string_view mode = argc > 1 ? argv[1] : "";
+    const bool modeCommandes = mode == "--commandes";
+    // Hors menu, la sortie standard ne reçoit que les réponses.
+    std::ostream& messages = mode.empty() ? std::cout : std::cerr;
+    const std::filesystem::path fichierCSV = "taches.csv";
+    const std::filesystem::path fichierInstantane = "taches.bin";
+    const std::filesystem::path fichierJournal = "taches.journal";
     GestionnaireTaches gestionnaire;
+    gestionnaire.activerIndexRecherche();
+    gestionnaire.activerVuesTriees();
 
-    if (gestionnaire.chargerCSV(fichier)) {
-        std::cout << "Données chargées depuis " << fichier << ".\n";
+    // Premier lancement : on reprend l'ancien fichier CSV s'il existe. Ensuite,
+    // taches.csv n'est plus relu : seul --exporter-csv le réécrit.
+    if (!std::filesystem::exists(fichierInstantane) && gestionnaire.chargerCSV(fichierCSV)) {
+        messages << "Données importées depuis " << fichierCSV << ".\n";
+        const auto& bilan = gestionnaire.bilanChargement();
+        if (bilan.lignesIgnorees > 0) {
+            messages << "Attention : " << bilan.lignesIgnorees
+                     << " ligne(s) illisible(s) ignorée(s) ; " << fichierCSV
+                     << " est conservé tel quel.\n";
+        }
+    }
+    if (!gestionnaire.ouvrirStockage(fichierInstantane, fichierJournal)) {
+        messages << "Impossible d'ouvrir " << fichierInstantane << " et " << fichierJournal
+                 << ".\n";
+        return 1;
+    }
+    // Dates illisibles de l'import CSV ou de l'instantané.
+    if (const auto dates = gestionnaire.bilanChargement().datesIgnorees; dates > 0) {
+        messages << "Attention : " << dates
+                 << " date(s) illisible(s), tâche(s) gardée(s) sans échéance.\n";
+    }
+
+    if (mode == "--exporter-csv") {
+        const std::filesystem::path cible = argc > 2 ? argv[2] : fichierCSV;
+        if (!gestionnaire.sauvegarderCSV(cible)) {
+            messages << "Impossible d'écrire " << cible << ".\n";
+            return 1;
+        }
+        messages << gestionnaire.taille() << " tâche(s) exportée(s) dans " << cible << ".\n";
+        return 0;
+    }
+    if (mode == "--serveur") {
+#if defined(__linux__)
+        ServeurTaches serveur(gestionnaire);
+        const std::filesystem::path socket = argc > 2 ? argv[2] : "taches.sock";
+        if (!serveur.ecouter(socket)) {
+            messages << "Impossible d'écouter sur " << socket << ".\n";
+            return 1;
+        }
+        serveurActif = &serveur;
+        std::signal(SIGINT, [](int) { serveurActif->arreter(); });
+        std::signal(SIGTERM, [](int) { serveurActif->arreter(); });
+        messages << "Serveur prêt sur " << socket << " (Ctrl+C pour arrêter).\n";
+        serveur.servir();
+        return 0;
+#else
+        messages << "Le mode serveur n'est pas disponible sur cette plateforme"
+                 << " (Linux seulement).\n";
+        return 1;
+#endif
+    }
+    if (modeCommandes) {
+        std::ios::sync_with_stdio(false);
+        std::ifstream fichier;
+        if (argc > 2) {
+            fichier.open(argv[2]);
+            if (!fichier) {
+                messages << "Impossible de lire " << argv[2] << ".\n";
+                return 1;
+            }
+        }
+        const auto bilan = executerCommandes(gestionnaire, argc > 2 ? fichier : std::cin, std::cout);
+        gestionnaire.synchroniser();
+        messages << bilan.commandes << " commande(s), " << bilan.erreurs << " erreur(s).\n";
+        return bilan.erreurs == 0 ? 0 : 2;
     }
 
     bool actif = true;
@@ -309,7 +205,10 @@ int main() {
                     std::cout << "Description vide, tâche ignorée.\n";
                     break;
                 }
-                gestionnaire.ajouterTache(description, priorite, date);
+                if (!gestionnaire.ajouterTache(description, priorite, date)) {
+                    std::cout << "Date invalide (format YYYY-MM-DD), tâche ignorée.\n";
+                    break;
+                }
                 std::cout << "Tâche ajoutée !\n";
                 break;
             }
@@ -341,39 +240,29 @@ int main() {
                 break;
             case 5:
                 gestionnaire.trierParPriorite();
-                std::cout << "Tâches triées par priorité.\n";
+                std::cout << "Les tâches seront listées par priorité.\n";
                 break;
             case 6:
                 gestionnaire.trierParDate();
-                std::cout << "Tâches triées par date.\n";
+                std::cout << "Les tâches seront listées par date.\n";
                 break;
             case 7: {
                 std::string motCle = lireLigne("Mot-clé : ");
                 auto resultat = gestionnaire.rechercherMotCle(motCle);
                 std::cout << "\n=== Résultats de recherche ===\n";
-                for (const auto& tache : resultat) {
-                    GestionnaireTaches::afficherTache(tache);
-                }
-                if (resultat.empty()) {
-                    std::cout << "Aucune tâche correspondante.\n";
-                }
+                afficherLignes(gestionnaire, resultat, "Aucune tâche correspondante.");
                 break;
             }
             case 8: {
                 Statut statut = demanderStatut();
                 auto resultat = gestionnaire.filtrerParStatut(statut);
                 std::cout << "\n=== Tâches filtrées ===\n";
-                for (const auto& tache : resultat) {
-                    GestionnaireTaches::afficherTache(tache);
-                }
-                if (resultat.empty()) {
-                    std::cout << "Aucune tâche pour ce statut.\n";
-                }
+                afficherLignes(gestionnaire, resultat, "Aucune tâche pour ce statut.");
                 break;
             }
             case 9:
-                if (gestionnaire.sauvegarderCSV(fichier)) {
-                    std::cout << "Sauvegarde réussie dans " << fichier << ".\n";
+                if (gestionnaire.synchroniser()) {
+                    std::cout << "Sauvegarde réussie dans " << fichierJournal << ".\n";
                 } else {
                     std::cout << "Erreur lors de la sauvegarde.\n";
                 }
@@ -381,13 +270,26 @@ int main() {
             case 10:
                 actif = false;
                 break;
+            case 11: {
+                auto debut = demanderDate("Du (YYYY-MM-DD) : ");
+                auto fin = debut ? demanderDate("Au (YYYY-MM-DD) : ") : std::nullopt;
+                if (fin) {
+                    std::cout << "\n=== Échéances ===\n";
+                    afficherLignes(gestionnaire, gestionnaire.echeancesEntre(*debut, *fin));
+                }
+                break;
+            }
+            case 12:
+                std::cout << "\n=== Tâches en retard ===\n";
+                afficherLignes(gestionnaire, gestionnaire.enRetard());
+                break;
             default:
                 std::cout << "Choix inconnu.\n";
                 break;
         }
     }
 
-    gestionnaire.sauvegarderCSV(fichier);
+    gestionnaire.synchroniser();
     std::cout << "Au revoir !\n";
     return 0;
 }
@@ -396,4 +298,7 @@ int main() {
  * Compilation et exécution :
  * g++ -std=c++20 -Wall -Wextra -Wpedantic -O2 todo.cpp -o todo
  * ./todo
+ * ./todo --exporter-csv [taches.csv]
+ * ./todo --commandes script.tsv    (ou : ./todo --commandes < script.tsv)
+ * ./todo --serveur [taches.sock]      (Linux seulement)
  */
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include "table_taches.hpp"
+
+enum class Ordre {
+    Insertion,
+    Priorite,    // priorité décroissante
+    Date         // échéance croissante, tâches sans échéance en premier
+};
+
+// Deux ordres secondaires tenus à jour en O(log n) : la table reste dans
+// l'ordre d'insertion et lister dans l'un de ces ordres est un simple
+// parcours, sans tri.
+// Chaque entrée tient sur 64 bits : la clé de tri dans les bits de poids
+// fort, l'id dans les bits de poids faible (à clé égale, l'ordre des ids).
+class VuesTriees {
+public:
+    void vider() {
+        parPriorite_.clear();
+        parDate_.clear();
+    }
+
+    // Reconstruit les deux ordres en triant une fois les clés : insérer des
+    // clés déjà triées en fin d'ensemble coûte O(1) chacune.
+    template <typename ParcourirTaches>
+    void construire(ParcourirTaches&& parcourir) {
+        std::vector<std::uint64_t> priorites;
+        std::vector<std::uint64_t> dates;
+        parcourir([&](const Tache& t) {
+            priorites.push_back(clePriorite(t));
+            dates.push_back(cleDate(t));
+        });
+        remplir(parPriorite_, priorites);
+        remplir(parDate_, dates);
+    }
+
+    void ajouter(const Tache& tache) {
+        parPriorite_.insert(clePriorite(tache));
+        parDate_.insert(cleDate(tache));
+    }
+    void retirer(const Tache& tache) {
+        parPriorite_.erase(clePriorite(tache));
+        parDate_.erase(cleDate(tache));
+    }
+
+    // Appelle `fonction(id)` dans l'ordre demandé (Priorite ou Date), pour
+    // les `limite` premières tâches au plus. Si `fonction` renvoie un bool,
+    // false arrête le parcours.
+    template <typename Fonction>
+    void parcourir(Ordre ordre, Fonction&& fonction,
+                   std::size_t limite = std::numeric_limits<std::size_t>::max()) const {
+        for (const auto cle : ordre == Ordre::Priorite ? parPriorite_ : parDate_) {
+            if (limite-- == 0) {
+                break;
+            }
+            const int id = static_cast<int>(static_cast<std::uint32_t>(cle) ^ 0x80000000u);
+            if constexpr (std::is_same_v<std::invoke_result_t<Fonction&, int>, bool>) {
+                if (!fonction(id)) {
+                    break;
+                }
+            } else {
+                fonction(id);
+            }
+        }
+    }
+
+    // Appelle `fonction(id)` pour chaque échéance comprise entre `debut` et
+    // `fin` (inclus), par date croissante : O(log n) pour trouver la
+    // première, puis un pas par résultat.
+    template <typename Fonction>
+    void parcourirEcheances(DateCompacte debut, DateCompacte fin, Fonction&& fonction) const {
+        const auto dernier = parDate_.lower_bound((std::uint64_t{fin} + 1) << 32);
+        for (auto it = parDate_.lower_bound(std::uint64_t{debut} << 32); it != dernier; ++it) {
+            fonction(static_cast<int>(static_cast<std::uint32_t>(*it) ^ 0x80000000u));
+        }
+    }
+
+private:
+    // Le bit de signe est inversé pour que les ids négatifs passent avant.
+    static std::uint64_t cleId(int id) {
+        return static_cast<std::uint32_t>(id) ^ 0x80000000u;
+    }
+    static std::uint64_t clePriorite(const Tache& t) {
+        return std::uint64_t{3u - static_cast<std::uint8_t>(t.priorite)} << 32 | cleId(t.id);
+    }
+    static std::uint64_t cleDate(const Tache& t) {
+        return std::uint64_t{t.dateEcheance} << 32 | cleId(t.id);
+    }
+
+    static void remplir(std::set<std::uint64_t>& vue, std::vector<std::uint64_t>& cles) {
+        std::sort(cles.begin(), cles.end());
+        vue.clear();
+        for (const auto cle : cles) {
+            vue.emplace_hint(vue.end(), cle);
+        }
+    }
+
+    std::set<std::uint64_t> parPriorite_;
+    std::set<std::uint64_t> parDate_;
+};
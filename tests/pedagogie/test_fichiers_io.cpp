@@ -0,0 +1,258 @@
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../exemples/11-etudiants-csv.hpp"
+
+bool memesEtudiants(const std::vector<Etudiant>& a, const std::vector<Etudiant>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].nom != b[i].nom || a[i].prenom != b[i].prenom || a[i].moyenne != b[i].moyenne) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Le tri externe doit donner exactement std::stable_sort en mémoire, quel
+// que soit le budget : un paquet par étudiant (budget 1, avec fusions
+// intermédiaires au-delà de 64 paquets), quelques paquets, ou un seul.
+void testerTriExterne(const std::filesystem::path& dossier) {
+    const auto entree = dossier / "test_fichiers_io.csv";
+    const auto sortie = dossier / "test_fichiers_io_tries.csv";
+
+    // Beaucoup d'égalités : 300 étudiants pour 7 moyennes possibles. Le nom
+    // porte le rang d'origine, pour vérifier la stabilité.
+    std::vector<Etudiant> etudiants;
+    std::mt19937 generateur(22);
+    std::uniform_int_distribution<int> note(0, 6);
+    for (int i = 0; i < 300; ++i) {
+        etudiants.push_back({"Nom" + std::to_string(i), "Prenom", 8.0 + 1.5 * note(generateur)});
+    }
+    OptionsSauvegarde sansSynchro;
+    sansSynchro.synchroniser = false;
+    sauvegarderCSV(entree, etudiants, sansSynchro);
+
+    auto attendu = etudiants;
+    std::stable_sort(attendu.begin(), attendu.end(),
+                     [](const auto& a, const auto& b) { return a.moyenne > b.moyenne; });
+
+    for (const std::size_t budget : {std::size_t{1}, std::size_t{2000}, std::size_t{64 * 1024},
+                                     std::size_t{64 * 1024 * 1024}}) {
+        for (const unsigned nbThreads : {1u, 3u}) {
+            OptionsTriExterne options;
+            options.budgetOctets = budget;
+            options.nbThreads = nbThreads;
+            options.dossierTemporaire = dossier;
+            assert(trierCSVExterne(entree, sortie, options) == etudiants.size());
+            assert(memesEtudiants(chargerCSV(sortie), attendu));
+        }
+    }
+
+    // Fichier vide : un fichier trié vide.
+    std::ofstream(entree, std::ios::trunc).close();
+    OptionsTriExterne options;
+    options.budgetOctets = 1;
+    assert(trierCSVExterne(entree, sortie, options) == 0);
+    assert(std::filesystem::exists(sortie) && std::filesystem::file_size(sortie) == 0);
+    assert(chargerCSV(sortie).empty());
+
+    std::filesystem::remove(entree);
+    std::filesystem::remove(sortie);
+}
+
+std::string contenu(const std::filesystem::path& fichier) {
+    std::ifstream entree(fichier, std::ios::binary);
+    std::ostringstream texte;
+    texte << entree.rdbuf();
+    return texte.str();
+}
+
+// Chaque sauvegarde décale les générations (.1 la plus récente) et oublie
+// la plus ancienne ; la génération .1 est un lien dur vers l'ancien
+// fichier, pas une copie. Un écrivain qui lève une exception laisse le
+// fichier intact et ne laisse pas de .tmp derrière lui.
+void testerSauvegarde(const std::filesystem::path& dossier) {
+    const auto fichier = dossier / "test_fichiers_io_sauvegarde.csv";
+    OptionsSauvegarde options;
+    options.synchroniser = false;
+    options.generations = 3;
+    options.dossierBackup = dossier / "test_fichiers_io_backup";
+    std::filesystem::remove(fichier);
+    std::filesystem::remove_all(options.dossierBackup);
+    auto generation = [&](int numero) {
+        return options.dossierBackup / (fichier.filename().string() + "." + std::to_string(numero));
+    };
+    auto version = [](int numero) { return "version " + std::to_string(numero) + "\n"; };
+
+    for (int numero = 0; numero < 5; ++numero) {
+        ecrireAtomique(fichier, options, [&](std::ostream& sortie) { sortie << version(numero); });
+        assert(contenu(fichier) == version(numero));
+        for (int g = 1; g <= options.generations; ++g) {
+            assert(std::filesystem::exists(generation(g)) == (g <= numero));
+            assert(g > numero || contenu(generation(g)) == version(numero - g));
+        }
+        assert(!std::filesystem::exists(generation(options.generations + 1)));
+    }
+
+    // Juste après la rotation, l'ancien fichier et sa génération .1 sont
+    // le même fichier sur le disque.
+    tournerSauvegardes(fichier, options);
+    assert(std::filesystem::equivalent(fichier, generation(1)));
+    assert(std::filesystem::hard_link_count(fichier) == 2);
+    assert(contenu(generation(2)) == version(3));
+
+    auto temporaire = fichier;
+    temporaire += ".tmp";
+    bool leve = false;
+    try {
+        ecrireAtomique(fichier, options, [](std::ostream& sortie) {
+            sortie << "à moitié";
+            throw std::runtime_error("écrivain interrompu");
+        });
+    } catch (const std::runtime_error&) {
+        leve = true;
+    }
+    assert(leve);
+    assert(!std::filesystem::exists(temporaire));
+    assert(contenu(fichier) == version(4));
+    assert(std::filesystem::equivalent(fichier, generation(1)));
+
+    std::filesystem::remove(fichier);
+    std::filesystem::remove_all(options.dossierBackup);
+}
+
+std::vector<Etudiant> lireAvecTampon(const std::filesystem::path& fichier,
+                                    std::size_t tailleTampon) {
+    std::vector<Etudiant> etudiants;
+    for (const EtudiantVue& e : LecteurEtudiants(fichier, tailleTampon)) {
+        etudiants.push_back({std::string(e.nom), std::string(e.prenom), e.moyenne});
+    }
+    return etudiants;
+}
+
+// Un tampon à peine plus grand que la plus longue ligne, rechargé à chaque
+// ligne ou presque, lit les mêmes étudiants que le tampon par défaut.
+// Une ligne plus longue que le tampon est signalée avec son numéro puis
+// sautée, sans décaler les numéros des lignes suivantes.
+void testerLecteur(const std::filesystem::path& dossier) {
+    const auto fichier = dossier / "test_fichiers_io_lecteur.csv";
+
+    std::vector<Etudiant> etudiants;
+    std::mt19937 generateur(21);
+    std::uniform_int_distribution<int> longueur(1, 20);
+    std::size_t plusLongue = 0;
+    {
+        std::ofstream sortie(fichier, std::ios::binary | std::ios::trunc);
+        for (int i = 0; i < 500; ++i) {
+            Etudiant etudiant{std::string(static_cast<std::size_t>(longueur(generateur)), 'n'),
+                              std::string(static_cast<std::size_t>(longueur(generateur)), 'p'),
+                              static_cast<double>(i % 201) / 10.0};
+            std::ostringstream ligne;
+            ecrireEtudiant(ligne, etudiant.nom, etudiant.prenom, etudiant.moyenne);
+            plusLongue = std::max(plusLongue, ligne.str().size());
+            sortie << ligne.str();
+            etudiants.push_back(etudiant);
+        }
+    }
+    assert(memesEtudiants(chargerCSV(fichier), etudiants));
+    for (const std::size_t taille : {plusLongue, plusLongue + 1, std::size_t{100}}) {
+        assert(memesEtudiants(lireAvecTampon(fichier, taille), etudiants));
+    }
+
+    {
+        std::ofstream sortie(fichier, std::ios::binary | std::ios::trunc);
+        sortie << "Martin,Alice,15.5\n"
+               << "Durand,Eva,17.2\n"
+               << "Bernard," << std::string(200, 'x') << ",12\n"
+               << "Petit,Louis,9\n"
+               << "mal formée\n"
+               << std::string(64, 'y') << "\n"
+               << "Moreau,Jade,11";    // dernière ligne sans '\n'
+    }
+    std::ostringstream erreurs;
+    auto* const ancien = std::cerr.rdbuf(erreurs.rdbuf());
+    std::vector<std::string> noms;
+    LecteurEtudiants lecteur(fichier, 32);
+    for (const EtudiantVue& e : lecteur) {
+        noms.emplace_back(e.nom);
+    }
+    std::cerr.rdbuf(ancien);
+    assert((noms == std::vector<std::string>{"Martin", "Durand", "Petit", "Moreau"}));
+    assert(erreurs.str() == "Ligne 3 trop longue, ignorée.\n"
+                            "Ligne 5 mal formée, ignorée.\n"
+                            "Ligne 6 trop longue, ignorée.\n");
+    assert(lecteur.lignesLues() == 7);
+    assert(lecteur.lignesIgnorees() == 3);
+
+    std::filesystem::remove(fichier);
+}
+
+std::optional<double> moyenneAvecStod(const std::string& texte) {
+    try {
+        return std::stod(texte);
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+bool memesBits(double a, double b) {
+    return std::bit_cast<std::uint64_t>(a) == std::bit_cast<std::uint64_t>(b);
+}
+
+// to_chars puis moyenneDepuisTexte redonne exactement (bit à bit) le même
+// double ; sur des textes mal formés ou limites, moyenneDepuisTexte prend
+// les mêmes décisions que l'ancienne lecture par std::stod.
+void testerConversions() {
+    std::mt19937_64 generateur(23);
+    for (int i = 0; i < 200'000; ++i) {
+        const double valeur = i % 2 == 0 ? std::bit_cast<double>(generateur())
+                                         : static_cast<double>(generateur() % 2001) / 100.0;
+        if (!std::isnormal(valeur) && valeur != 0) {
+            continue;
+        }
+        char texte[32];
+        const auto fin = std::to_chars(std::begin(texte), std::end(texte), valeur).ptr;
+        const auto relue =
+            moyenneDepuisTexte(std::string_view(texte, static_cast<std::size_t>(fin - texte)));
+        assert(relue && memesBits(*relue, valeur));
+    }
+
+    for (const char* texte : {"12.5", "  12.5", "\t7", "+3", "+-3", "--3", "0x1p3", "0X1.8", "0x",
+                              "0x-1", "12abc", ".5", "5.", "e5", "", "abc", "-0", "1e400", "1e-310",
+                              "1e-400", "inf", "-INF", "nan", "1e+", " +.5", "1,5", "0x1p-1080"}) {
+        const auto attendu = moyenneAvecStod(texte);
+        const auto obtenu = moyenneDepuisTexte(texte);
+        assert(attendu.has_value() == obtenu.has_value());
+        assert(!attendu || memesBits(*attendu, *obtenu) ||
+               (std::isnan(*attendu) && std::isnan(*obtenu)));
+    }
+
+    // ecrireEtudiant écrit la moyenne la plus courte qui se relit à l'identique.
+    std::ostringstream ligne;
+    ecrireEtudiant(ligne, "Durand", "Eva", 17.2);
+    assert(ligne.str() == "Durand,Eva,17.2\n");
+}
+
+int main() {
+    const auto dossier = std::filesystem::temp_directory_path();
+    testerConversions();
+    testerLecteur(dossier);
+    testerSauvegarde(dossier);
+    testerTriExterne(dossier);
+    return 0;
+}
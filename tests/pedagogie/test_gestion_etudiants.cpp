@@ -0,0 +1,86 @@
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#define EXEMPLE_SANS_MAIN
+#include "../../exemples/07-gestion-etudiants.cpp"
+
+// Mêmes statistiques à l'arrondi près pour les sommes, faites dans un autre
+// ordre ; tout le reste doit être identique.
+bool memesStatistiques(const StatistiquesEtudiants& a, const StatistiquesEtudiants& b) {
+    auto proches = [](double x, double y) {
+        return std::abs(x - y) <= 1e-9 * std::max(1.0, std::abs(x));
+    };
+    return a.nombre == b.nombre && a.min == b.min && a.max == b.max &&
+           a.indiceMin == b.indiceMin && a.indiceMax == b.indiceMax &&
+           a.parTranche == b.parTranche && proches(a.moyenne, b.moyenne) &&
+           proches(a.variance, b.variance) && proches(a.ageMoyen, b.ageMoyen);
+}
+
+// Le passage unique sur les colonnes (4 voies, blocs de 4096) contre la
+// version par pointeurs, un passage par agrégat.
+void comparer(const std::vector<double>& moyennes, const std::vector<int>& ages) {
+    GestionnaireEtudiants gestionnaire;
+    TableEtudiants table;
+    for (std::size_t i = 0; i < moyennes.size(); ++i) {
+        const std::string nom = "E" + std::to_string(moyennes.size() - i);
+        gestionnaire.ajouterEtudiant(std::make_unique<Etudiant>(nom, ages[i], moyennes[i]));
+        table.ajouterEtudiant(nom, ages[i], moyennes[i]);
+    }
+    const auto attendu = gestionnaire.calculerStatistiques();
+    assert(memesStatistiques(table.statistiques(), attendu));
+    std::size_t total = 0;
+    for (const auto n : attendu.parTranche) {
+        total += n;
+    }
+    assert(total == moyennes.size());
+
+    // Les deux rangements trient de la même façon.
+    gestionnaire.trierParNom();
+    table.trierParNom();
+    assert(memesStatistiques(table.statistiques(), gestionnaire.calculerStatistiques()));
+}
+
+int main() {
+    // Table vide : rien à calculer.
+    const auto vide = calculerStatistiques({}, {});
+    assert(vide.nombre == 0 && vide.parTranche == StatistiquesEtudiants{}.parTranche);
+    comparer({}, {});
+
+    // Tailles qui ne sont pas des multiples de 4 (fin de la boucle des
+    // voies) ou qui tombent autour d'une frontière de bloc ; les extrêmes
+    // sont placés en dernière position, donc dans la fin de boucle.
+    std::mt19937 generateur(25);
+    std::uniform_int_distribution<int> note(0, 2000);
+    std::uniform_int_distribution<int> age(17, 30);
+    for (const std::size_t n : {1, 2, 3, 5, 6, 7, 9, 4095, 4096, 4097, 4099, 10'003}) {
+        std::vector<double> moyennes;
+        std::vector<int> ages;
+        for (std::size_t i = 0; i < n; ++i) {
+            moyennes.push_back(note(generateur) / 100.0);
+            ages.push_back(age(generateur));
+        }
+        comparer(moyennes, ages);
+        moyennes.back() = 20.0;
+        comparer(moyennes, ages);
+        moyennes.back() = 0.0;
+        comparer(moyennes, ages);
+    }
+
+    // Égalités : le premier étudiant qui atteint le min ou le max, y compris
+    // d'un bloc à l'autre ; 20 compte dans la dernière tranche, 4 dans la
+    // deuxième.
+    std::vector<double> egales(9000, 12.0);
+    egales[10] = egales[5000] = 20.0;
+    egales[7] = egales[8999] = 4.0;
+    const std::vector<int> ages(egales.size(), 20);
+    const auto s = calculerStatistiques(egales, ages);
+    assert(s.indiceMax == 10 && s.indiceMin == 7);
+    assert(s.parTranche[4] == 2 && s.parTranche[1] == 2 && s.parTranche[3] == 8996);
+    assert(s.ageMoyen == 20.0);
+    comparer(egales, ages);
+    return 0;
+}
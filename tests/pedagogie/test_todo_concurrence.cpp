@@ -0,0 +1,100 @@
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../projets/01-todo-app/magasin_concurrent.hpp"
+
+// Isolation par instantané : un lecteur ne voit jamais un lot à moitié
+// appliqué, ni une version qui change sous ses yeux.
+int main() {
+    constexpr int nbTaches = 20'000;    // plusieurs morceaux
+    constexpr int moitie = nbTaches / 2;
+    GestionnaireTaches source;
+    for (int i = 0; i < nbTaches; ++i) {
+        source.ajouterTache("Tâche " + std::to_string(i + 1), Priorite::Moyenne, "2025-06-01");
+    }
+    source.supprimerTache(7);
+    MagasinConcurrent magasin(source);
+
+    // Une version gardée ne bouge plus ; la suivante voit les changements.
+    const auto avant = magasin.instantane();
+    assert(avant->taille() == nbTaches - 1 && !avant->trouver(7));
+    assert(avant->trouver(8)->description == "Tâche 8");
+    assert(magasin.changerStatut(8, Statut::Terminee));
+    assert(magasin.supprimerTache(9));
+    assert(magasin.ajouterTache("Nouvelle", Priorite::Haute, "") == nbTaches + 1);
+    assert(!magasin.changerStatut(9, Statut::EnCours));
+    assert(!magasin.ajouterTache("Date invalide", Priorite::Basse, "2025-13-01"));
+    assert(avant->trouver(8)->statut == Statut::AFaire && avant->trouver(9));
+    assert(avant->compterParStatut()[0] == nbTaches - 1);
+    const auto apres = magasin.instantane();
+    assert(apres->numero() == avant->numero() + 3);
+    assert(apres->trouver(8)->statut == Statut::Terminee && !apres->trouver(9));
+    assert(apres->filtrerParStatut(Statut::Terminee) == std::vector<int>{8});
+    assert(apres->rechercherMotCle("Nouvelle") == std::vector<int>{nbTaches + 1});
+
+    // Les tâches k et k + moitie, dans des morceaux différents, changent
+    // toujours de statut ensemble ; chaque lot ajoute aussi une tâche et
+    // retire la précédente : la taille ne varie pas.
+    std::atomic<bool> fini = false;
+    std::thread ecrivain([&] {
+        std::mt19937 generateur(1);
+        std::uniform_int_distribution<int> tache(10, moitie);
+        int derniere = nbTaches + 1;
+        for (int n = 0; n < 2'000; ++n) {
+            const int k = tache(generateur);
+            const auto statut = static_cast<Statut>(n % 3);
+            LotTaches lot;
+            lot.changerStatut(k, statut);
+            lot.ajouter("Éphémère", Priorite::Basse, "");
+            lot.supprimer(derniere);
+            lot.changerStatut(k + moitie, statut);
+            const auto ids = magasin.appliquer(lot);
+            assert(ids && ids->size() == 1);
+            derniere = ids->front();
+        }
+        fini = true;
+    });
+
+    std::vector<std::thread> lecteurs;
+    std::atomic<std::size_t> nbLectures = 0;
+    for (int l = 0; l < 3; ++l) {
+        lecteurs.emplace_back([&] {
+            std::uint64_t dernierNumero = 0;
+            std::vector<Statut> statuts(nbTaches + 1);
+            do {
+                const auto version = magasin.instantane();
+                assert(version->numero() >= dernierNumero);
+                dernierNumero = version->numero();
+                const auto comptes = version->compterParStatut();
+                std::size_t parcourues = 0;
+                version->pourChaqueTache([&](const Tache& t) {
+                    ++parcourues;
+                    if (t.id <= nbTaches) {
+                        statuts[static_cast<std::size_t>(t.id)] = t.statut;
+                    }
+                });
+                assert(version->taille() == nbTaches - 1);
+                assert(parcourues == version->taille());
+                assert(comptes[0] + comptes[1] + comptes[2] == parcourues);
+                for (int k = 10; k <= moitie; ++k) {
+                    assert(statuts[static_cast<std::size_t>(k)] ==
+                           statuts[static_cast<std::size_t>(k + moitie)]);
+                }
+                assert(version->compterParStatut() == comptes);
+                ++nbLectures;
+            } while (!fini);
+        });
+    }
+    ecrivain.join();
+    for (auto& lecteur : lecteurs) {
+        lecteur.join();
+    }
+    assert(nbLectures > 0);
+    assert(magasin.instantane()->numero() == apres->numero() + 2'000);
+    return 0;
+}
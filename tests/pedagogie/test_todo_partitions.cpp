@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../projets/01-todo-app/magasin_partitionne.hpp"
+
+// Écritures concurrentes dans un magasin partitionné, puis requêtes sur
+// toutes les partitions : mêmes résultats qu'en recomptant à la main.
+int main() {
+    constexpr int nbThreads = 4;
+    constexpr int parThread = 3'000;
+    MagasinPartitionne magasin(nbThreads);
+    magasin.activerVuesTriees();
+
+    std::mutex verrou;
+    std::set<int> tousLesIds;
+    std::set<int> terminees;
+    std::set<int> supprimees;
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < nbThreads; ++t) {
+            threads.emplace_back([&, t] {
+                std::vector<int> ids;
+                for (int i = 0; i < parThread; ++i) {
+                    char date[11];
+                    std::snprintf(date, sizeof(date), "2025-%02d-%02d", i % 12 + 1, i % 28 + 1);
+                    const auto description = "fil " + std::to_string(t) + " tâche " + std::to_string(i);
+                    const auto id = magasin.ajouterTache(description, static_cast<Priorite>(i % 3 + 1),
+                                                         i % 7 == 0 ? "" : date);
+                    assert(id);
+                    ids.push_back(*id);
+                }
+                std::lock_guard garde(verrou);
+                for (std::size_t i = 0; i < ids.size(); ++i) {
+                    assert(tousLesIds.insert(ids[i]).second);
+                    if (i % 10 == 0) {
+                        assert(magasin.supprimerTache(ids[i]));
+                        supprimees.insert(ids[i]);
+                    } else if (i % 3 == 0) {
+                        assert(magasin.changerStatut(ids[i], Statut::Terminee));
+                        terminees.insert(ids[i]);
+                    }
+                }
+            });
+        }
+    }
+
+    // Un thread par partition : les blocs d'ids couvrent les quatre.
+    std::set<int> partitions;
+    for (const int id : tousLesIds) {
+        partitions.insert((id - 1) / MagasinPartitionne::tailleBlocIds % nbThreads);
+    }
+    assert(partitions.size() == nbThreads);
+
+    const std::size_t attendu = tousLesIds.size() - supprimees.size();
+    assert(magasin.taille() == attendu);
+    assert(!magasin.changerStatut(0, Statut::EnCours));
+    assert(!magasin.supprimerTache(*supprimees.begin()));
+    assert(!magasin.consulter(*tousLesIds.rbegin() + 1, [](const Tache&) {}));
+    const int unId = *terminees.begin();
+    assert(magasin.consulter(unId, [unId](const Tache& t) {
+        assert(t.id == unId && t.statut == Statut::Terminee);
+    }));
+
+    const auto filtre = magasin.filtrerParStatut(Statut::Terminee);
+    assert(filtre == std::vector<int>(terminees.begin(), terminees.end()));
+    assert(magasin.compterParStatut()[2] == terminees.size());
+    std::size_t nbAttendues = 0;
+    for (int i = 0; i < parThread; ++i) {
+        nbAttendues += std::to_string(i).starts_with("12") && i % 10 != 0;
+    }
+    const auto trouvees = magasin.rechercherMotCle("fil 2 tâche 12");
+    assert(std::is_sorted(trouvees.begin(), trouvees.end()));
+    assert(trouvees.size() == nbAttendues);
+
+    // Listes fusionnées : complètes et dans l'ordre de chaque critère. Les
+    // k premières retenues par topK sont le début de cette liste.
+    const auto ouverte = [](const Tache& t) { return t.statut != Statut::Terminee; };
+    for (const auto ordre : {Ordre::Insertion, Ordre::Priorite, Ordre::Date}) {
+        std::vector<Tache> liste;
+        magasin.pourChaqueTache(ordre, [&liste](const Tache& t) { liste.push_back(t); });
+        assert(liste.size() == attendu);
+        std::vector<int> tous;
+        std::vector<int> ouvertes;
+        for (const Tache& t : liste) {
+            tous.push_back(t.id);
+            if (ouverte(t)) {
+                ouvertes.push_back(t.id);
+            }
+        }
+        for (const std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{20}, attendu + 1}) {
+            const auto debut = [k](const std::vector<int>& ids) {
+                return std::vector<int>(ids.begin(), ids.begin() + std::min(k, ids.size()));
+            };
+            assert(magasin.topK(k, ordre) == debut(tous));
+            assert(magasin.topK(k, ordre, ouverte) == debut(ouvertes));
+        }
+        for (std::size_t i = 1; i < liste.size(); ++i) {
+            const Tache& a = liste[i - 1];
+            const Tache& b = liste[i];
+            if (ordre == Ordre::Priorite && a.priorite != b.priorite) {
+                assert(a.priorite > b.priorite);
+            } else if (ordre == Ordre::Date && a.dateEcheance != b.dateEcheance) {
+                assert(a.dateEcheance < b.dateEcheance);
+            } else {
+                assert(a.id < b.id);
+            }
+        }
+    }
+    return 0;
+}
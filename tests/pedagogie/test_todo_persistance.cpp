@@ -0,0 +1,351 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../projets/01-todo-app/commandes.hpp"
+#include "../../projets/01-todo-app/taches.hpp"
+
+// Tache est une vue sur le gestionnaire : on en garde une copie autonome
+// pour comparer des gestionnaires différents.
+struct Copie {
+    int id;
+    std::string description;
+    Statut statut;
+    Priorite priorite;
+    DateCompacte dateEcheance;
+
+    bool operator==(const Copie&) const = default;
+};
+
+std::vector<Copie> contenu(const GestionnaireTaches& gestionnaire) {
+    std::vector<Copie> taches;
+    gestionnaire.pourChaqueTache([&](const Tache& t) {
+        taches.push_back({t.id, std::string(t.description), t.statut, t.priorite, t.dateEcheance});
+    });
+    return taches;
+}
+
+bool identiques(const std::vector<Copie>& a, const std::vector<Copie>& b) {
+    return a == b;
+}
+
+int main() {
+    const auto dossier = std::filesystem::temp_directory_path();
+    const auto fichierCSV = dossier / "test_todo_persistance.csv";
+    const auto fichierBinaire = dossier / "test_todo_persistance.bin";
+
+    GestionnaireTaches source;
+    source.ajouterTache("Acheter du pain", Priorite::Basse, "2025-01-10");
+    source.ajouterTache("Relire \"le\" rapport; puis l'envoyer", Priorite::Haute, "2025-02-01");
+    source.ajouterTache("Chemin C:\\temp\\ à nettoyer", Priorite::Moyenne, "");
+    source.ajouterTache("", Priorite::Moyenne, "2025-03-15");
+    source.ajouterTache("À supprimer", Priorite::Basse, "2025-04-01");
+    source.changerStatut(2, Statut::EnCours);
+    source.changerStatut(4, Statut::Terminee);
+    source.supprimerTache(5);
+    const auto attendu = contenu(source);
+    assert(attendu.size() == 4);
+
+    // Une date qui n'est pas au format ISO est refusée.
+    assert(!source.ajouterTache("Date invalide", Priorite::Basse, "demain"));
+    assert(source.taille() == 4);
+    assert(source.trouver(2) && source.trouver(2)->description == "Relire \"le\" rapport; puis l'envoyer");
+    assert(dateVersTexte(source.trouver(1)->dateEcheance) == "2025-01-10");
+
+    // Aller-retour CSV, dans les deux modes de chargement.
+    assert(source.sauvegarderCSV(fichierCSV));
+    GestionnaireTaches depuisFlux;
+    assert(depuisFlux.chargerCSV(fichierCSV, ModeChargement::Flux));
+    assert(identiques(contenu(depuisFlux), attendu));
+    GestionnaireTaches depuisProjection;
+    assert(depuisProjection.chargerCSV(fichierCSV, ModeChargement::Projection, 4));
+    assert(identiques(contenu(depuisProjection), attendu));
+
+    // Le même fichier en fins de ligne Windows (CRLF), avec en plus une date
+    // libre de l'ancienne application et une ligne illisible : la tâche à
+    // la date illisible est gardée sans échéance, et les deux sont comptées.
+    {
+        std::ifstream lf(fichierCSV);
+        std::string crlf, ligne;
+        while (std::getline(lf, ligne)) {
+            crlf += ligne + "\r\n";
+        }
+        crlf += "7;\"Date libre\";A_FAIRE;BASSE;demain\r\n";
+        crlf += "pas une tâche\r\n\r\n";
+        std::ofstream(fichierCSV, std::ios::binary) << crlf;
+    }
+    auto attenduCRLF = attendu;
+    attenduCRLF.push_back({7, "Date libre", Statut::AFaire, Priorite::Basse, sansEcheance});
+    for (const auto mode : {ModeChargement::Flux, ModeChargement::Projection}) {
+        GestionnaireTaches depuisCRLF;
+        assert(depuisCRLF.chargerCSV(fichierCSV, mode));
+        assert(identiques(contenu(depuisCRLF), attenduCRLF));
+        assert(depuisCRLF.bilanChargement().datesIgnorees == 1);
+        assert(depuisCRLF.bilanChargement().lignesIgnorees == 1);
+    }
+    assert(depuisProjection.bilanChargement().datesIgnorees == 0);
+    assert(depuisProjection.bilanChargement().lignesIgnorees == 0);
+
+    // Aller-retour binaire.
+    assert(source.sauvegarderInstantane(fichierBinaire));
+    GestionnaireTaches depuisInstantane;
+    assert(depuisInstantane.chargerInstantane(fichierBinaire));
+    assert(identiques(contenu(depuisInstantane), attendu));
+
+    depuisInstantane.ajouterTache("Nouvelle", Priorite::Haute, "2025-05-05");
+    assert(depuisInstantane.taille() == 5);
+
+    // Un instantané tronqué est refusé et ne modifie pas le gestionnaire.
+    const auto taille = std::filesystem::file_size(fichierBinaire);
+    std::filesystem::resize_file(fichierBinaire, taille - 1);
+    assert(!depuisInstantane.chargerInstantane(fichierBinaire));
+    assert(depuisInstantane.taille() == 5);
+
+    // Un CSV n'est pas un instantané.
+    assert(!depuisInstantane.chargerInstantane(fichierCSV));
+
+    // Un instantané d'une autre version est refusé.
+    {
+        assert(source.sauvegarderInstantane(fichierBinaire));
+        std::fstream fichier(fichierBinaire, std::ios::in | std::ios::out | std::ios::binary);
+        const std::uint32_t autreVersion = 2;
+        fichier.seekp(8);
+        fichier.write(reinterpret_cast<const char*>(&autreVersion), sizeof(autreVersion));
+        fichier.close();
+        GestionnaireTaches autre;
+        assert(!autre.chargerInstantane(fichierBinaire));
+        assert(autre.taille() == 0);
+    }
+
+    // Une date hors du calendrier dans l'instantané : comme au chargement
+    // CSV, la tâche est gardée sans échéance et comptée.
+    {
+        assert(source.sauvegarderInstantane(fichierBinaire));
+        std::fstream fichier(fichierBinaire, std::ios::in | std::ios::out | std::ios::binary);
+        const DateCompacte horsCalendrier = 0xFFFFFFFF;
+        fichier.seekp(static_cast<std::streamoff>(instantane::tailleEnTete + 16 * attendu.size()));
+        fichier.write(reinterpret_cast<const char*>(&horsCalendrier), sizeof(horsCalendrier));
+        fichier.close();
+        GestionnaireTaches relu;
+        assert(relu.chargerInstantane(fichierBinaire));
+        auto attenduSansDate = attendu;
+        attenduSansDate[0].dateEcheance = sansEcheance;
+        assert(identiques(contenu(relu), attenduSansDate));
+        assert(relu.bilanChargement().datesIgnorees == 1);
+    }
+
+    // Descriptions internées : partagées en mémoire, écrites une seule fois
+    // dans l'instantané, et toujours partagées après une compaction.
+    {
+        GestionnaireTaches interne;
+        interne.activerInternement();
+        for (int i = 0; i < 100; ++i) {
+            interne.ajouterTache(i % 2 == 0 ? "Relire" : "Appeler le client", Priorite::Basse, "");
+        }
+        assert(interne.trouver(1)->description.data() == interne.trouver(3)->description.data());
+        for (int id = 1; id <= 60; ++id) {
+            interne.supprimerTache(id);
+        }
+        assert(interne.trouver(61)->description.data() == interne.trouver(63)->description.data());
+        assert(interne.trouver(62)->description == "Appeler le client");
+
+        assert(interne.sauvegarderInstantane(fichierBinaire));
+        assert(std::filesystem::file_size(fichierBinaire) ==
+               instantane::tailleEnTete + 40 * instantane::octetsParTache + 6 + 17);
+        GestionnaireTaches relu;
+        assert(relu.chargerInstantane(fichierBinaire));
+        assert(identiques(contenu(relu), contenu(interne)));
+    }
+
+    // Une description vide internée, suivie d'un autre texte : les deux
+    // peuvent avoir la même adresse dans l'arène, l'instantané doit quand
+    // même réserver la place du second.
+    {
+        GestionnaireTaches interne;
+        interne.activerInternement();
+        interne.ajouterTache("", Priorite::Basse, "");
+        interne.ajouterTache("Vingt-six caractères pile", Priorite::Haute, "2025-08-01");
+        interne.ajouterTache("", Priorite::Moyenne, "");
+        assert(interne.sauvegarderInstantane(fichierBinaire));
+        GestionnaireTaches relu;
+        assert(relu.chargerInstantane(fichierBinaire));
+        assert(identiques(contenu(relu), contenu(interne)));
+        assert(relu.trouver(2)->description == "Vingt-six caractères pile");
+    }
+
+    // Journal : les modifications survivent à la fermeture sans réécrire
+    // l'instantané, et un enregistrement déchiré en fin de journal est ignoré.
+    const auto fichierJournal = dossier / "test_todo_persistance.journal";
+    std::filesystem::remove(fichierBinaire);
+    std::filesystem::remove(fichierJournal);
+    std::vector<Copie> attenduJournal;
+    {
+        GestionnaireTaches journalise;
+        assert(journalise.ouvrirStockage(fichierBinaire, fichierJournal));
+        journalise.ajouterTache("Écrire le journal; vite", Priorite::Haute, "2025-06-01");
+        journalise.ajouterTache("Tâche éphémère", Priorite::Basse, "");
+        journalise.changerStatut(1, Statut::EnCours);
+        journalise.supprimerTache(2);
+        assert(journalise.synchroniser());
+        attenduJournal = contenu(journalise);
+    }
+    assert(std::filesystem::file_size(fichierJournal) > 0);
+    {
+        std::ofstream dechire(fichierJournal, std::ios::binary | std::ios::app);
+        const char incomplet[] = {0x40, 0, 0, 0, 0x12, 0x34, 0x56, 0x78, 'a'};
+        dechire.write(incomplet, sizeof(incomplet));
+    }
+    {
+        GestionnaireTaches relu;
+        assert(relu.ouvrirStockage(fichierBinaire, fichierJournal));
+        assert(identiques(contenu(relu), attenduJournal));
+        relu.ajouterTache("Après reprise", Priorite::Moyenne, "2025-07-01");
+        attenduJournal = contenu(relu);
+        assert(relu.consolider());
+    }
+    {
+        GestionnaireTaches relu;
+        assert(relu.ouvrirStockage(fichierBinaire, fichierJournal));
+        assert(identiques(contenu(relu), attenduJournal));
+    }
+
+    // Instantané supprimé mais journal resté là (session jamais consolidée) :
+    // un nouvel import repart du CSV seul, sans rejouer ce journal.
+    std::filesystem::remove(fichierBinaire);
+    std::filesystem::remove(fichierJournal);
+    {
+        GestionnaireTaches session;
+        assert(session.ouvrirStockage(fichierBinaire, fichierJournal));
+        session.ajouterTache("Ajout jamais consolidé", Priorite::Haute, "");
+        session.supprimerTache(1);
+        assert(session.synchroniser());
+    }
+    std::filesystem::remove(fichierBinaire);
+    {
+        GestionnaireTaches import;
+        import.ajouterTache("Importée du CSV", Priorite::Basse, "");
+        const auto attenduImport = contenu(import);
+        assert(import.ouvrirStockage(fichierBinaire, fichierJournal));
+        assert(identiques(contenu(import), attenduImport));
+    }
+    {
+        GestionnaireTaches relu;
+        assert(relu.ouvrirStockage(fichierBinaire, fichierJournal));
+        assert(relu.taille() == 1 && relu.trouver(1)->description == "Importée du CSV");
+    }
+
+    // Lot : même résultat qu'une suite d'appels, ou rien du tout si une
+    // opération est invalide. Il est journalisé en un seul enregistrement.
+    std::filesystem::remove(fichierBinaire);
+    std::filesystem::remove(fichierJournal);
+    {
+        GestionnaireTaches unParUn;
+        GestionnaireTaches parLot;
+        parLot.activerIndexRecherche();
+        parLot.activerVuesTriees();
+        assert(parLot.ouvrirStockage(fichierBinaire, fichierJournal));
+        LotTaches lot;
+        for (int i = 0; i < 20; ++i) {
+            const auto description = "Importée " + std::to_string(i);
+            unParUn.ajouterTache(description, Priorite::Moyenne, "2025-05-01");
+            lot.ajouter(description, Priorite::Moyenne, "2025-05-01");
+        }
+        unParUn.changerStatut(3, Statut::Terminee);
+        unParUn.supprimerTache(4);
+        unParUn.supprimerTache(3);
+        lot.changerStatut(3, Statut::Terminee);
+        lot.supprimer(4);
+        lot.supprimer(3);
+        const auto ids = parLot.appliquer(lot);
+        assert(ids && ids->size() == 20 && ids->front() == 1 && ids->back() == 20);
+        assert(identiques(contenu(parLot), contenu(unParUn)));
+        assert(parLot.rechercherMotCle("Importée 1").size() == 11);
+
+        const auto avant = contenu(parLot);
+        LotTaches refuse;
+        refuse.ajouter("Valide", Priorite::Haute, "");
+        refuse.supprimer(5);
+        refuse.changerStatut(5, Statut::EnCours);    // déjà supprimée dans ce lot
+        assert(!parLot.appliquer(refuse));
+        refuse.vider();
+        refuse.supprimer(1);
+        refuse.ajouter("Date invalide", Priorite::Basse, "2025-02-30");
+        assert(!parLot.appliquer(refuse));
+        assert(identiques(contenu(parLot), avant));
+        assert(parLot.trouver(21) == std::nullopt);
+        assert(parLot.synchroniser());
+    }
+    {
+        GestionnaireTaches relu;
+        assert(relu.ouvrirStockage(fichierBinaire, fichierJournal));
+        assert(relu.taille() == 18 && !relu.trouver(3) && !relu.trouver(4));
+        assert(relu.ajouterTache("Suivante", Priorite::Basse, "") == 21);
+    }
+
+    // Mode commandes : une réponse par commande, dans l'ordre, même quand
+    // un lot refusé est rejoué commande par commande.
+    std::filesystem::remove(fichierBinaire);
+    std::filesystem::remove(fichierJournal);
+    {
+        GestionnaireTaches gestionnaire;
+        gestionnaire.activerIndexRecherche();
+        assert(gestionnaire.ouvrirStockage(fichierBinaire, fichierJournal));
+        std::istringstream script(
+            "# premières tâches\n"
+            "ajouter\tHAUTE\t2025-06-01\tRéviser les équations\n"
+            "ajouter\tBASSE\t\tcourses du soir\n"
+            "statut\t2\tTERMINEE\n"
+            "\n"
+            "statut\t9\tEN_COURS\n"
+            "ajouter\tMOYENNE\t2025-02-30\tdate impossible\n"
+            "ajouter\tURGENTE\t\tpriorité inconnue\n"
+            "rechercher\téqua\n"
+            "supprimer\t1\n"
+            "filtrer\tTERMINEE\n"
+            "sauvegarder\n"
+            "effacer\ttout\n");
+        std::ostringstream reponses;
+        const auto bilan = executerCommandes(gestionnaire, script, reponses);
+        assert(bilan.commandes == 11 && bilan.erreurs == 4);
+        assert(reponses.str() ==
+               "ok\t1\nok\t2\nok\n"
+               "erreur\t6\ttâche introuvable\n"
+               "erreur\t7\tdate invalide\n"
+               "erreur\t8\tpriorité inconnue\n"
+               "ok\t1\n1\tA_FAIRE\tHAUTE\t2025-06-01\tRéviser les équations\n"
+               "ok\n"
+               "ok\t1\n2\tTERMINEE\tBASSE\t\tcourses du soir\n"
+               "ok\n"
+               "erreur\t13\tcommande inconnue\n");
+
+        // Au-delà de tailleLot, le lot est appliqué en plusieurs fois.
+        std::string beaucoup;
+        for (std::size_t i = 0; i < InterpreteurCommandes::tailleLot + 10; ++i) {
+            beaucoup += "ajouter\tMOYENNE\t2025-07-01\tlot " + std::to_string(i) + "\n";
+        }
+        beaucoup += "statut\t3\tEN_COURS\n";
+        std::istringstream entree(beaucoup);
+        std::ostringstream sortie;
+        assert(executerCommandes(gestionnaire, entree, sortie).erreurs == 0);
+        assert(sortie.str().starts_with("ok\t3\nok\t4\n") && sortie.str().ends_with("\nok\n"));
+        assert(gestionnaire.taille() == InterpreteurCommandes::tailleLot + 11);
+        assert(gestionnaire.synchroniser());
+    }
+    {
+        GestionnaireTaches relu;
+        assert(relu.ouvrirStockage(fichierBinaire, fichierJournal));
+        assert(relu.taille() == InterpreteurCommandes::tailleLot + 11 && !relu.trouver(1));
+        assert(relu.trouver(2)->statut == Statut::Terminee);
+        assert(relu.trouver(3)->statut == Statut::EnCours);
+    }
+
+    std::filesystem::remove(fichierCSV);
+    std::filesystem::remove(fichierBinaire);
+    std::filesystem::remove(fichierJournal);
+    return 0;
+}
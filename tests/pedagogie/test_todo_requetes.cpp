@@ -0,0 +1,517 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../projets/01-todo-app/taches.hpp"
+
+// Les trois versions des noyaux (scalaire, SSE2, AVX2) doivent donner le
+// même résultat, y compris sur les octets de fin qui ne remplissent pas un
+// registre. Seules celles que le processeur sait exécuter sont testées.
+void testerNoyaux() {
+    std::vector<simd::Jeu> jeux = {simd::Jeu::Scalaire};
+    if (simd::jeuDisponible() != simd::Jeu::Scalaire) {
+        jeux.push_back(simd::Jeu::SSE2);
+    }
+    if (simd::jeuDisponible() == simd::Jeu::AVX2) {
+        jeux.push_back(simd::Jeu::AVX2);
+    }
+
+    std::mt19937 generateur(3);
+    std::uniform_int_distribution<int> octet(0, 3);
+    for (const std::size_t n : {0, 1, 15, 16, 17, 31, 33, 100, 255 * 32 + 7, 20'000}) {
+        std::vector<std::uint8_t> colonne(n);
+        for (auto& o : colonne) {
+            o = static_cast<std::uint8_t>(octet(generateur));
+        }
+        if (n > 10) {
+            colonne[5] = TableTaches::ligneLibre;
+        }
+
+        simd::Selection attendue;
+        std::array<std::size_t, 3> comptesAttendus{};
+        for (std::size_t i = 0; i < n; ++i) {
+            if (colonne[i] == 2) {
+                attendue.push_back(static_cast<std::uint32_t>(i));
+            }
+            if (colonne[i] >= 1 && colonne[i] <= 3) {
+                ++comptesAttendus[colonne[i] - 1];
+            }
+        }
+        for (const auto jeu : jeux) {
+            assert(simd::selectionnerEgal(colonne.data(), n, 2, jeu) == attendue);
+            assert(simd::compterValeurs<3>(colonne.data(), n, 1, jeu) == comptesAttendus);
+        }
+    }
+}
+
+void testerFiltresEtComptes() {
+    GestionnaireTaches gestionnaire;
+    for (int i = 0; i < 100; ++i) {
+        gestionnaire.ajouterTache("tâche", static_cast<Priorite>(1 + i % 3), "");
+    }
+    for (int id = 1; id <= 100; id += 4) {
+        gestionnaire.changerStatut(id, Statut::EnCours);
+    }
+    gestionnaire.supprimerTache(1);
+    gestionnaire.supprimerTache(2);
+
+    const auto enCours = gestionnaire.filtrerParStatut(Statut::EnCours);
+    assert(enCours.size() == 24);
+    for (const auto ligne : enCours) {
+        const auto tache = gestionnaire.table().ligne(ligne);
+        assert(tache.statut == Statut::EnCours && tache.id % 4 == 1);
+    }
+
+    // Les tâches supprimées ne sont comptées nulle part.
+    const auto statuts = gestionnaire.compterParStatut();
+    assert(statuts[0] == 74 && statuts[1] == 24 && statuts[2] == 0);
+    const auto priorites = gestionnaire.compterParPriorite();
+    assert(priorites[0] == 33 && priorites[1] == 32 && priorites[2] == 33);
+}
+
+// Avec ou sans index des trigrammes, la recherche donne les mêmes lignes,
+// y compris après suppressions, compaction et rechargement.
+void testerRecherche() {
+    static const char* const mots[] = {"rapport", "réunion", "facture", "rap", "port", "ra"};
+    // Les numéros de ligne dépendent des compactions : on compare les ids.
+    auto ids = [](const GestionnaireTaches& gestionnaire, const char* motif) {
+        std::vector<int> resultat;
+        for (const auto ligne : gestionnaire.rechercherMotCle(motif)) {
+            resultat.push_back(gestionnaire.table().ligne(ligne).id);
+        }
+        return resultat;
+    };
+    auto verifier = [&ids](const GestionnaireTaches& indexe, const GestionnaireTaches& simple) {
+        for (const char* motif : {"rapport", "port", "rap", "ra", "", "n°1", "réu", "zzz",
+                                  "facture n°7", "t r"}) {
+            assert(ids(indexe, motif) == ids(simple, motif));
+        }
+    };
+
+    GestionnaireTaches indexe;
+    GestionnaireTaches simple;
+    indexe.activerIndexRecherche();
+    std::mt19937 generateur(11);
+    std::uniform_int_distribution<int> mot(0, 5);
+    for (int i = 0; i < 500; ++i) {
+        const std::string description = std::string(mots[mot(generateur)]) + ' ' +
+                                        mots[mot(generateur)] + " n°" + std::to_string(i);
+        indexe.ajouterTache(description, Priorite::Moyenne, "");
+        simple.ajouterTache(description, Priorite::Moyenne, "");
+    }
+    verifier(indexe, simple);
+    assert(!indexe.rechercherMotCle("rapport").empty());
+
+    // Assez de suppressions pour compacter la table et reconstruire l'index.
+    for (int id = 1; id <= 500; id += 2) {
+        indexe.supprimerTache(id);
+        simple.supprimerTache(id);
+    }
+    for (int id = 2; id <= 200; id += 4) {
+        indexe.supprimerTache(id);
+        simple.supprimerTache(id);
+    }
+    indexe.ajouterTache("rapport final", Priorite::Haute, "");
+    simple.ajouterTache("rapport final", Priorite::Haute, "");
+    verifier(indexe, simple);
+
+    const auto fichier = std::filesystem::temp_directory_path() / "test_todo_requetes.csv";
+    assert(simple.sauvegarderCSV(fichier));
+    assert(indexe.chargerCSV(fichier));
+    verifier(indexe, simple);
+    std::filesystem::remove(fichier);
+}
+
+// Les vues triées suivent ajouts et suppressions, et donnent le même ordre
+// que le tri calculé à la demande ; la table reste dans l'ordre d'insertion.
+void testerVuesTriees() {
+    auto ordreIds = [](const GestionnaireTaches& gestionnaire, Ordre ordre) {
+        std::vector<int> ids;
+        gestionnaire.pourChaqueTache(ordre, [&ids](const Tache& t) { ids.push_back(t.id); });
+        return ids;
+    };
+    auto verifier = [&ordreIds](const GestionnaireTaches& avecVues, const GestionnaireTaches& sansVues) {
+        for (const auto ordre : {Ordre::Insertion, Ordre::Priorite, Ordre::Date}) {
+            assert(ordreIds(avecVues, ordre) == ordreIds(sansVues, ordre));
+        }
+        const auto insertion = ordreIds(avecVues, Ordre::Insertion);
+        assert(std::is_sorted(insertion.begin(), insertion.end()));
+        std::vector<Tache> parDate;
+        avecVues.pourChaqueTache(Ordre::Date, [&parDate](const Tache& t) { parDate.push_back(t); });
+        assert(std::is_sorted(parDate.begin(), parDate.end(), [](const Tache& a, const Tache& b) {
+            return a.dateEcheance < b.dateEcheance;
+        }));
+    };
+
+    GestionnaireTaches avecVues;
+    GestionnaireTaches sansVues;
+    avecVues.activerVuesTriees();
+    std::mt19937 generateur(5);
+    std::uniform_int_distribution<int> priorite(1, 3);
+    std::uniform_int_distribution<int> jour(0, 28);
+    std::uniform_int_distribution<int> operation(0, 9);
+    for (int i = 0; i < 2000; ++i) {
+        if (operation(generateur) < 3 && i > 0) {
+            std::uniform_int_distribution<int> id(1, i);
+            const int cible = id(generateur);
+            assert(avecVues.supprimerTache(cible) == sansVues.supprimerTache(cible));
+        } else {
+            const auto p = static_cast<Priorite>(priorite(generateur));
+            const int j = jour(generateur);
+            const std::string date = j == 0 ? "" : "2025-03-" + std::string(j < 10 ? "0" : "") +
+                                                       std::to_string(j);
+            avecVues.ajouterTache("tâche", p, date);
+            sansVues.ajouterTache("tâche", p, date);
+        }
+    }
+    avecVues.changerStatut(2, Statut::Terminee);
+    sansVues.changerStatut(2, Statut::Terminee);
+    verifier(avecVues, sansVues);
+
+    // trierParDate ne déplace plus les tâches.
+    avecVues.trierParDate();
+    verifier(avecVues, sansVues);
+
+    const auto fichier = std::filesystem::temp_directory_path() / "test_todo_vues.csv";
+    assert(sansVues.sauvegarderCSV(fichier));
+    assert(avecVues.chargerCSV(fichier));
+    verifier(avecVues, sansVues);
+    std::filesystem::remove(fichier);
+}
+
+void testerDates() {
+    assert(dateDepuisTexte("2024-02-29") && !dateDepuisTexte("2025-02-29"));
+    assert(!dateDepuisTexte("2025-04-31") && !dateDepuisTexte("2025-13-01"));
+    assert(!dateDepuisTexte("25-01-01") && !dateDepuisTexte("2025/01/01"));
+    assert(dateDepuisTexte("") == sansEcheance);
+    for (const char* texte : {"0000-01-01", "1999-12-31", "2000-02-29", "2025-06-15", "9999-12-31"}) {
+        assert(dateVersTexte(*dateDepuisTexte(texte)) == texte);
+    }
+    // Un jour de plus = une unité de plus, y compris d'un mois ou d'une année à l'autre.
+    assert(*dateDepuisTexte("2025-01-01") - *dateDepuisTexte("2024-12-31") == 1);
+    assert(*dateDepuisTexte("2024-03-01") - *dateDepuisTexte("2024-02-28") == 2);
+}
+
+// Les requêtes par intervalle de dates donnent la même réponse avec ou sans
+// vues triées, et la même qu'un parcours naïf.
+void testerEcheances() {
+    auto ids = [](const GestionnaireTaches& gestionnaire, const simd::Selection& lignes) {
+        std::vector<int> resultat;
+        for (const auto ligne : lignes) {
+            resultat.push_back(gestionnaire.table().ligne(ligne).id);
+        }
+        return resultat;
+    };
+
+    GestionnaireTaches avecVues;
+    GestionnaireTaches sansVues;
+    avecVues.activerVuesTriees();
+    std::mt19937 generateur(8);
+    std::uniform_int_distribution<int> jour(0, 60);
+    const DateCompacte premierMars = *dateDepuisTexte("2025-03-01");
+    for (int i = 0; i < 1000; ++i) {
+        const int j = jour(generateur);
+        const std::string date = j == 0 ? "" : dateVersTexte(premierMars + static_cast<DateCompacte>(j));
+        avecVues.ajouterTache("tâche", Priorite::Moyenne, date);
+        sansVues.ajouterTache("tâche", Priorite::Moyenne, date);
+    }
+    for (int id = 1; id <= 1000; id += 7) {
+        avecVues.supprimerTache(id);
+        sansVues.supprimerTache(id);
+        avecVues.changerStatut(id + 1, Statut::Terminee);
+        sansVues.changerStatut(id + 1, Statut::Terminee);
+    }
+
+    for (const auto& [debut, fin] : {std::pair{premierMars, premierMars + 10},
+                                    std::pair{premierMars + 30, premierMars + 30},
+                                    std::pair{DateCompacte{0}, date_compacte::maximum},
+                                    std::pair{premierMars + 20, premierMars + 5}}) {
+        const auto attendu = ids(sansVues, sansVues.echeancesEntre(debut, fin));
+        assert(ids(avecVues, avecVues.echeancesEntre(debut, fin)) == attendu);
+        std::size_t nbNaif = 0;
+        sansVues.pourChaqueTache([&](const Tache& t) {
+            nbNaif += t.dateEcheance != sansEcheance && t.dateEcheance >= debut && t.dateEcheance <= fin;
+        });
+        assert(attendu.size() == nbNaif);
+    }
+
+    const DateCompacte jour15 = premierMars + 15;
+    const auto retard = ids(avecVues, avecVues.enRetard(jour15));
+    assert(retard == ids(sansVues, sansVues.enRetard(jour15)));
+    assert(!retard.empty());
+    for (const int id : retard) {
+        const auto tache = avecVues.trouver(id);
+        assert(tache->dateEcheance < jour15 && tache->dateEcheance != sansEcheance);
+        assert(tache->statut != Statut::Terminee);
+    }
+}
+
+// Le rendu par blocs donne les mêmes lignes que l'ancien affichage par
+// std::setw (textes ASCII), et une liste limitée aux N premières tâches
+// commence comme la liste complète.
+void testerRendu() {
+    GestionnaireTaches gestionnaire;
+    for (int i = 0; i < 3000; ++i) {
+        const std::string date =
+            i % 5 == 0 ? "" : "2025-0" + std::to_string(i % 9 + 1) + "-1" + std::to_string(i % 10);
+        gestionnaire.ajouterTache("tache " + std::to_string(i * 7919 % 3000),
+                                  static_cast<Priorite>(i % 3 + 1), date);
+    }
+    gestionnaire.changerStatut(2, Statut::EnCours);
+    gestionnaire.changerStatut(3, Statut::Terminee);
+
+    std::ostringstream ancien;
+    std::ostringstream nouveau;
+    {
+        RenduTaches rendu(nouveau);
+        gestionnaire.pourChaqueTache([&](const Tache& t) {
+            ancien << "- [" << t.id << "] " << std::setw(30) << std::left << t.description << " | "
+                   << std::setw(8) << versTexte(t.statut) << " | " << std::setw(7)
+                   << versTexte(t.priorite) << " | " << dateVersTexte(t.dateEcheance) << "\n";
+            rendu.ajouter(t);
+        });
+    }
+    assert(ancien.str().size() > RenduTaches::tailleBloc);
+    assert(nouveau.str() == ancien.str());
+
+    // Largeur en caractères : les colonnes restent alignées malgré les accents.
+    std::ostringstream accents;
+    {
+        RenduTaches rendu(accents);
+        rendu.ajouter(Tache{1, "Réviser les équations", Statut::AFaire, Priorite::Haute, sansEcheance});
+        rendu.ajouter(Tache{2, "Reviser les equations", Statut::AFaire, Priorite::Haute, sansEcheance});
+    }
+    const auto lignes = accents.str();
+    const auto milieu = lignes.find('\n') + 1;
+    assert(lignes.substr(0, milieu).find(" | ") == lignes.substr(milieu).find(" | ") + 2);
+
+    for (const bool vues : {false, true}) {
+        gestionnaire.activerVuesTriees(vues);
+        for (const auto ordre : {Ordre::Insertion, Ordre::Priorite, Ordre::Date}) {
+            std::vector<int> complet;
+            gestionnaire.pourChaqueTache(ordre, [&](const Tache& t) { complet.push_back(t.id); });
+            std::vector<int> premieres;
+            gestionnaire.pourLesPremieres(ordre, 25, [&](const Tache& t) { premieres.push_back(t.id); });
+            assert(premieres == std::vector<int>(complet.begin(), complet.begin() + 25));
+        }
+    }
+    gestionnaire.trierParPriorite();
+    std::ostringstream liste;
+    gestionnaire.listerTaches(2, liste);
+    std::ostringstream attendu;
+    attendu << "\n=== Liste des tâches ===\n";
+    gestionnaire.pourLesPremieres(Ordre::Priorite, 2, [&](const Tache& t) {
+        GestionnaireTaches::afficherTache(t, attendu);
+    });
+    attendu << "... et 2998 autre(s)\n";
+    assert(liste.str() == attendu.str());
+}
+
+// Une requête composée donne, quel que soit le plan choisi (avec ou sans
+// index et vues), les mêmes tâches qu'un filtrage naïf dans l'ordre de la
+// liste ; décalage et limite en découpent une tranche.
+// L'échantillon couvre toute la table : quand seules les premières tâches
+// sont terminées, l'estimation suit leur part réelle, même si le nombre de
+// lignes n'est pas un multiple de la taille de l'échantillon.
+void testerEchantillon() {
+    GestionnaireTaches gestionnaire;
+    constexpr int nbTaches = 3000;
+    for (int i = 0; i < nbTaches; ++i) {
+        gestionnaire.ajouterTache("tâche", Priorite::Moyenne, "");
+    }
+    for (int id = 1; id <= 1000; ++id) {
+        gestionnaire.changerStatut(id, Statut::Terminee);
+    }
+    const auto terminee = static_cast<std::uint8_t>(Statut::Terminee);
+    const auto estimer = [&] {
+        const EchantillonTaches echantillon(gestionnaire.table());
+        const auto& statuts = gestionnaire.table().colonnes().statuts;
+        return echantillon.selectivite([&](std::size_t i) { return statuts[i] == terminee; });
+    };
+    assert(std::abs(estimer() - 1000.0 / nbTaches) < 0.01);
+
+    // Les lignes libérées ne comptent pas : il reste 1000 terminées sur 2000.
+    for (int id = 2001; id <= nbTaches; ++id) {
+        gestionnaire.supprimerTache(id);
+    }
+    assert(std::abs(estimer() - 0.5) < 0.01);
+}
+
+void testerPlanificateur() {
+    std::array<GestionnaireTaches, 4> gestionnaires;
+    gestionnaires[1].activerIndexRecherche();
+    gestionnaires[2].activerVuesTriees();
+    gestionnaires[3].activerIndexRecherche();
+    gestionnaires[3].activerVuesTriees();
+
+    constexpr std::array<std::string_view, 4> mots = {"deploy", "revue", "courses", "appel"};
+    const DateCompacte premierMars = *dateDepuisTexte("2025-03-01");
+    std::mt19937 generateur(18);
+    std::uniform_int_distribution<int> tirage(0, 59);
+    for (int i = 0; i < 3000; ++i) {
+        const int n = tirage(generateur);
+        // « deploy » est rare : une tâche sur 60.
+        const std::string description =
+            std::string(mots[n == 0 ? 0 : 1 + n % 3]) + " n°" + std::to_string(i);
+        const auto priorite = static_cast<Priorite>(1 + n % 3);
+        const std::string date = n % 5 == 0 ? "" : dateVersTexte(premierMars + static_cast<DateCompacte>(n));
+        for (auto& g : gestionnaires) {
+            g.ajouterTache(description, priorite, date);
+        }
+    }
+    for (int id = 1; id <= 3000; id += 11) {
+        for (auto& g : gestionnaires) {
+            g.supprimerTache(id);
+            g.changerStatut(id + 1, Statut::EnCours);
+            g.changerStatut(id + 2, Statut::Terminee);
+        }
+    }
+
+    auto ids = [](const ResultatRequete& resultat) {
+        std::vector<int> liste;
+        for (const Tache& t : resultat) {
+            liste.push_back(t.id);
+        }
+        return liste;
+    };
+
+    std::uniform_int_distribution<int> choix(0, 15);
+    for (int essai = 0; essai < 200; ++essai) {
+        const int masque = choix(generateur);
+        RequeteTaches requete;
+        const auto statut = static_cast<Statut>(essai % 3);
+        const auto priorite = static_cast<Priorite>(1 + essai / 3 % 3);
+        const DateCompacte debut = premierMars + static_cast<DateCompacte>(essai % 40);
+        const DateCompacte fin = debut + static_cast<DateCompacte>(essai % 15);
+        const std::string_view motCle = essai % 7 == 0 ? "de" : mots[essai % 4];
+        if (masque & 1) {
+            requete.statut(statut);
+        }
+        if (masque & 2) {
+            requete.priorite(priorite);
+        }
+        if (masque & 4) {
+            requete.echeanceEntre(debut, fin);
+        }
+        if (masque & 8) {
+            requete.motCle(motCle);
+        }
+
+        std::vector<int> attendu;
+        gestionnaires[0].pourChaqueTache([&](const Tache& t) {
+            if ((!(masque & 1) || t.statut == statut) && (!(masque & 2) || t.priorite == priorite) &&
+                (!(masque & 4) || (t.dateEcheance != sansEcheance && t.dateEcheance >= debut &&
+                                   t.dateEcheance <= fin)) &&
+                (!(masque & 8) || t.description.find(motCle) != std::string_view::npos)) {
+                attendu.push_back(t.id);
+            }
+        });
+        for (const auto& g : gestionnaires) {
+            assert(ids(g.executer(requete)) == attendu);
+        }
+
+        const std::size_t decalage = attendu.size() / 3;
+        const auto page = ids(gestionnaires[3].executer(RequeteTaches(requete).decaler(decalage).limiter(5)));
+        const auto finPage = std::min(attendu.size(), decalage + 5);
+        assert(page == std::vector<int>(attendu.begin() + static_cast<std::ptrdiff_t>(decalage),
+                                        attendu.begin() + static_cast<std::ptrdiff_t>(finPage)));
+    }
+    assert(ids(gestionnaires[0].executer(RequeteTaches().limiter(0))).empty());
+
+    // Choix du plan.
+    using Acces = PlanRequete::Acces;
+    assert(gestionnaires[0].planifier(RequeteTaches()).acces == Acces::Parcours);
+    assert(gestionnaires[0].planifier(RequeteTaches()).filtres.empty());
+    assert(gestionnaires[0].planifier(RequeteTaches().statut(Statut::EnCours)).acces == Acces::Statut);
+    const auto requete = RequeteTaches().statut(Statut::AFaire).motCle("deploy");
+    assert(gestionnaires[0].planifier(requete).acces == Acces::Statut);
+    const auto plan = gestionnaires[1].planifier(requete);
+    assert(plan.acces == Acces::Trigrammes);
+    // Le statut, moins cher à vérifier, passe avant le mot-clé.
+    assert(plan.expliquer() == "trigrammes > statut > motCle");
+    // Sans vues, un intervalle de dates se vérifie ligne à ligne.
+    const auto semaine = RequeteTaches().echeanceEntre(premierMars + 1, premierMars + 2);
+    assert(gestionnaires[0].planifier(semaine).acces != Acces::Echeances);
+    assert(gestionnaires[2].planifier(semaine).acces == Acces::Echeances);
+    assert(gestionnaires[2].planifier(semaine).filtres.empty());
+}
+
+// topK donne les k premières tâches retenues de l'ordre complet, avec ou
+// sans vues, sur un ou plusieurs threads.
+void testerTopK() {
+    GestionnaireTaches avecVues;
+    GestionnaireTaches sansVues;
+    avecVues.activerVuesTriees();
+    std::mt19937 generateur(19);
+    std::uniform_int_distribution<int> priorite(1, 3);
+    std::uniform_int_distribution<int> jour(0, 28);
+    // Assez de lignes pour que la table soit coupée en plusieurs morceaux.
+    for (int i = 0; i < 300'000; ++i) {
+        const auto p = static_cast<Priorite>(priorite(generateur));
+        const int j = jour(generateur);
+        const std::string date = j == 0 ? "" : "2025-03-" + std::string(j < 10 ? "0" : "") +
+                                                   std::to_string(j);
+        avecVues.ajouterTache("tâche", p, date);
+        sansVues.ajouterTache("tâche", p, date);
+    }
+    for (int id = 1; id <= 300'000; id += 5) {
+        avecVues.supprimerTache(id);
+        sansVues.supprimerTache(id);
+        avecVues.changerStatut(id + 1, Statut::Terminee);
+        sansVues.changerStatut(id + 1, Statut::Terminee);
+    }
+
+    auto ouverte = [](const Tache& t) { return t.statut != Statut::Terminee; };
+    auto ids = [](const GestionnaireTaches& gestionnaire, const simd::Selection& lignes) {
+        std::vector<int> resultat;
+        for (const auto ligne : lignes) {
+            resultat.push_back(gestionnaire.table().ligne(ligne).id);
+        }
+        return resultat;
+    };
+    for (const auto ordre : {Ordre::Insertion, Ordre::Priorite, Ordre::Date}) {
+        std::vector<int> tous;
+        std::vector<int> ouvertes;
+        sansVues.pourChaqueTache(ordre, [&](const Tache& t) {
+            tous.push_back(t.id);
+            if (ouverte(t)) {
+                ouvertes.push_back(t.id);
+            }
+        });
+        for (const std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{20}, std::size_t{5000},
+                                    std::size_t{1'000'000}}) {
+            auto debut = [k](const std::vector<int>& liste) {
+                const auto taille = static_cast<std::ptrdiff_t>(std::min(k, liste.size()));
+                return std::vector<int>(liste.begin(), liste.begin() + taille);
+            };
+            assert(ids(sansVues, sansVues.topK(k, ordre)) == debut(tous));
+            for (const unsigned nbThreads : {1u, 4u}) {
+                assert(ids(sansVues, sansVues.topK(k, ordre, ouverte, nbThreads)) == debut(ouvertes));
+                assert(ids(avecVues, avecVues.topK(k, ordre, ouverte, nbThreads)) == debut(ouvertes));
+            }
+        }
+    }
+}
+
+int main() {
+    testerNoyaux();
+    testerFiltresEtComptes();
+    testerRecherche();
+    testerVuesTriees();
+    testerDates();
+    testerEcheances();
+    testerRendu();
+    testerEchantillon();
+    testerPlanificateur();
+    testerTopK();
+    return 0;
+}
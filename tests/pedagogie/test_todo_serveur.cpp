@@ -0,0 +1,144 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Le serveur de tâches n'existe que sous Linux : ailleurs, rien à tester.
+#if !defined(__linux__)
+int main() {
+    return 0;
+}
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../../projets/01-todo-app/client_taches.hpp"
+
+// Un serveur dans un thread, plusieurs clients : réponses dans l'ordre des
+// requêtes envoyées d'un bloc, et mêmes résultats qu'un appel direct.
+int main() {
+    const auto chemin = std::filesystem::temp_directory_path() / "test_todo_serveur.sock";
+    GestionnaireTaches gestionnaire;
+    gestionnaire.activerIndexRecherche();
+    gestionnaire.activerVuesTriees();
+    ServeurTaches serveur(gestionnaire);
+    assert(serveur.ecouter(chemin));
+    std::jthread boucle([&serveur] { serveur.servir(); });
+
+    // Pipelining : 200 ajouts, un changement de statut, une requête
+    // invalide, une recherche et une liste, envoyés d'un coup.
+    ClientTaches client;
+    assert(client.connecter(chemin));
+    for (int i = 0; i < 200; ++i) {
+        client.demanderAjout("tâche " + std::to_string(i), static_cast<Priorite>(i % 3 + 1),
+                             i % 4 == 0 ? "" : "2025-05-" + std::to_string(10 + i % 20));
+    }
+    client.demanderStatut(3, Statut::Terminee);
+    client.demanderStatut(999, Statut::EnCours);
+    client.demanderAjout("date impossible", Priorite::Basse, "2025-02-30");
+    client.demanderRecherche("tâche 19");
+    client.demanderListe(Ordre::Priorite, 5);
+    assert(client.envoyer());
+    for (int i = 0; i < 200; ++i) {
+        const auto reponse = client.recevoir();
+        assert(reponse && reponse->ok && reponse->id == i + 1);
+    }
+    assert(client.recevoir()->ok);
+    assert(!client.recevoir()->ok);
+    assert(!client.recevoir()->ok);
+    const auto trouvees = client.recevoir();
+    assert(trouvees && trouvees->taches.size() == 11);    // 19 et 190..199
+    assert(trouvees->taches.front().id == 20 && trouvees->taches.front().description == "tâche 19");
+    const auto premieres = client.recevoir();
+    assert(premieres && premieres->taches.size() == 5);
+    for (const auto& tache : premieres->taches) {
+        assert(tache.priorite == Priorite::Haute);
+    }
+
+    // Clients concurrents : chacun ajoute puis relit ses tâches.
+    {
+        std::vector<std::jthread> clients;
+        for (int c = 0; c < 8; ++c) {
+            clients.emplace_back([&chemin, c] {
+                ClientTaches autre;
+                assert(autre.connecter(chemin));
+                const std::string prefixe = "client" + std::to_string(c) + " ";
+                for (int i = 0; i < 100; ++i) {
+                    autre.demanderAjout(prefixe + std::to_string(i), Priorite::Moyenne, "");
+                }
+                assert(autre.envoyer());
+                std::vector<int> ids;
+                for (int i = 0; i < 100; ++i) {
+                    ids.push_back(autre.recevoir()->id);
+                }
+                assert(autre.changerStatut(ids[7], Statut::EnCours));
+                const auto miennes = autre.rechercherMotCle(prefixe);
+                assert(miennes && miennes->size() == 100);
+                for (std::size_t i = 0; i < 100; ++i) {
+                    assert((*miennes)[i].id == ids[i]);
+                    assert((*miennes)[i].statut == (i == 7 ? Statut::EnCours : Statut::AFaire));
+                }
+            });
+        }
+    }
+    const auto enCours = client.filtrerParStatut(Statut::EnCours);
+    assert(enCours && enCours->size() == 8);
+    const auto toutes = client.lister(Ordre::Insertion);
+    assert(toutes && toutes->size() == 1000);
+    assert(client.supprimerTache(1) && !client.supprimerTache(1));
+
+    // Une trame invalide (vide) ne ferme que sa connexion.
+    {
+        sockaddr_un adresse{};
+        adresse.sun_family = AF_UNIX;
+        std::strcpy(adresse.sun_path, chemin.c_str());
+        const int descripteur = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        assert(::connect(descripteur, reinterpret_cast<const sockaddr*>(&adresse),
+                         sizeof(adresse)) == 0);
+        const std::uint32_t longueur = 0;
+        assert(::send(descripteur, &longueur, sizeof(longueur), 0) == sizeof(longueur));
+        char octet;
+        assert(::recv(descripteur, &octet, 1, 0) == 0);
+        ::close(descripteur);
+    }
+    assert(client.lister(Ordre::Date, 1)->size() == 1);
+
+    // Une requête plus longue qu'une trame est refusée sans fermer la
+    // connexion. Une réponse plus longue est découpée en pages ; des listes
+    // demandées d'un coup dépassent le seuil de sortie du serveur et
+    // arrivent quand même toutes, complètes et dans l'ordre.
+    assert(!client.ajouterTache(std::string(protocole::tailleMaxTrame, 'x'), Priorite::Basse, ""));
+    constexpr int nbLongues = 300;
+    for (int i = 0; i < nbLongues; ++i) {
+        client.demanderAjout("longue " + std::to_string(i) + std::string(10'000, '.'),
+                             Priorite::Basse, "");
+    }
+    assert(client.envoyer());
+    for (int i = 0; i < nbLongues; ++i) {
+        assert(client.recevoir()->ok);
+    }
+    constexpr int nbListes = 8;
+    for (int l = 0; l < nbListes; ++l) {
+        client.demanderRecherche("longue ");
+    }
+    assert(client.envoyer());
+    for (int l = 0; l < nbListes; ++l) {
+        const auto longues = client.recevoir();
+        assert(longues && longues->ok && longues->taches.size() == nbLongues);
+        for (int i = 0; i < nbLongues; ++i) {
+            assert(longues->taches[i].description.starts_with("longue " + std::to_string(i) + "."));
+            assert(longues->taches[i].description.size() == 10'007 + std::to_string(i).size());
+        }
+    }
+    assert(client.lister(Ordre::Insertion)->size() == 999 + nbLongues);
+
+    serveur.arreter();
+    boucle.join();
+    assert(gestionnaire.taille() == 999 + nbLongues);
+    return 0;
+}
+#endif